@@ -1,8 +1,20 @@
 #include <iomanip>
+#include <iostream>
 #include <sstream>
 #include <assert.h>
+#include <stdexcept>
+#include <cstring>
+#include <algorithm>
 #include "calcwit.hpp"
+#ifdef WITNESS_TAPE
+#include "tape.hpp"
+#endif
+#ifdef PRUNE_SIGNALS
+#include "mimc.hpp"
+#endif
 
+extern void create_components(Circom_CalcWit* ctx);
+extern void release_memory_component(Circom_CalcWit* ctx, uint pos);
 extern void run(Circom_CalcWit* ctx);
 
 std::string int_to_hex( u64 i )
@@ -23,20 +35,34 @@ u64 fnv1a(std::string s) {
   return hash;
 }
 
-Circom_CalcWit::Circom_CalcWit (Circom_Circuit *aCircuit, uint maxTh) {
+Circom_CalcWit::Circom_CalcWit (Circom_Circuit *aCircuit, uint maxTh)
+  : templateInsId2IOSignalInfo(aCircuit->templateInsId2IOSignalInfo) {
   circuit = aCircuit;
   inputSignalAssignedCounter = get_main_input_signal_no();
   inputSignalAssigned = new bool[inputSignalAssignedCounter];
   for (int i = 0; i< inputSignalAssignedCounter; i++) {
     inputSignalAssigned[i] = false;
   }
-  signalValues = new FrElement[get_total_signal_no()];
-  Fr_str2element(&signalValues[0], "1", 10);
   componentMemory = new Circom_Component[get_number_of_components()];
   circuitConstants = circuit ->circuitConstants;
-  templateInsId2IOSignalInfo = circuit -> templateInsId2IOSignalInfo;
+
+  // the component tree is the same for every witness: it is created once
+  // here, and a new witness only restores the input counters
+  create_components(this);
+#ifdef PRUNE_SIGNALS
+  nSignals = pruneSignals();
+#else
+  nSignals = get_total_signal_no();
+#endif
+  signalValues = new FrElement[nSignals];
+  Fr_str2element(&signalValues[0], "1", 10);
+  initialInputCounters = new u32[get_number_of_components()];
+  for (uint i = 0; i < get_number_of_components(); i++) {
+    initialInputCounters[i] = componentMemory[i].inputCounter;
+  }
 
   maxThread = maxTh;
+  abortOnFailedAssert = false;
 
   // parallelism
   numThread = 0;
@@ -44,9 +70,102 @@ Circom_CalcWit::Circom_CalcWit (Circom_Circuit *aCircuit, uint maxTh) {
 }
 
 Circom_CalcWit::~Circom_CalcWit() {
-  // ...
+  joinAllParallel();
+  releaseComponents();
+  delete [] initialInputCounters;
+  delete [] inputSignalAssigned;
+  delete [] signalValues;
+  delete [] componentMemory;
+}
+
+void Circom_CalcWit::reset() {
+  joinAllParallel();
+  for (uint i = 0; i < get_number_of_components(); i++) {
+    componentMemory[i].inputCounter = initialInputCounters[i];
+  }
+  inputSignalAssignedCounter = get_main_input_signal_no();
+  for (int i = 0; i< inputSignalAssignedCounter; i++) {
+    inputSignalAssigned[i] = false;
+  }
+  numThread = 0;
+  inverseDests.clear();
+  inverseValues.clear();
+}
+
+void Circom_CalcWit::releaseComponents() {
+  // release_memory_component() of the generated code skips main
+  for (uint i = 1; i < get_number_of_components(); i++) {
+    release_memory_component(this, i);
+  }
+  Circom_Component &main = componentMemory[0];
+  delete [] main.subcomponents;
+  delete [] main.subcomponentsParallel;
+  delete [] main.outputIsSet;
+  delete [] main.mutexes;
+  delete [] main.cvs;
+  delete [] main.sbct;
+  main.subcomponents = NULL;
+  main.subcomponentsParallel = NULL;
+  main.outputIsSet = NULL;
+  main.mutexes = NULL;
+  main.cvs = NULL;
+  main.sbct = NULL;
+}
+
+#ifdef PRUNE_SIGNALS
+
+/*
+Pruned layout: the signals of every MiMCFeistel that are not in the
+witness (see mimc.hpp) are dropped from signalValues, and the signals
+after them move down. Only the native kernel addresses the signals of a
+Feistel, so the generated code follows once the start of every
+component is moved.
+*/
+
+static std::mutex prunedLayoutMutex;
+
+// The position in the pruned layout of signal s, for the sorted starts of the Feistels
+static u64 prunedSignalId(const std::vector<u64> &feistels, u64 s) {
+  u64 dropped = MIMC_FEISTEL_SIGNALS - MIMC_FEISTEL_SIZE;
+  u64 n = std::upper_bound(feistels.begin(), feistels.end(), s) - feistels.begin();
+  if (n > 0 && s < feistels[n-1] + MIMC_FEISTEL_SIGNALS) {
+    int k = MiMCFeistel_prunedOffset(s - feistels[n-1]);
+    if (k < 0) {
+      throw std::runtime_error("Signal " + std::to_string(s) + " is in the witness but not in the pruned layout\n");
+    }
+    return feistels[n-1] - (n-1)*dropped + k;
+  }
+  return s - n*dropped;
 }
 
+// Moves the components to the pruned layout, and returns its size
+uint Circom_CalcWit::pruneSignals() {
+  std::vector<u64> feistels;
+  for (uint i = 0; i < get_number_of_components(); i++) {
+    if (strcmp(componentMemory[i].templateName, "MiMCFeistel") == 0) {
+      feistels.push_back(componentMemory[i].signalStart);
+    }
+  }
+  std::sort(feistels.begin(), feistels.end());
+  if (!feistels.empty() && feistels[0] < get_main_input_signal_start() + get_main_input_signal_no()) {
+    throw std::runtime_error("The main inputs are not before the pruned signals\n");
+  }
+  for (uint i = 0; i < get_number_of_components(); i++) {
+    componentMemory[i].signalStart = prunedSignalId(feistels, componentMemory[i].signalStart);
+  }
+  std::lock_guard<std::mutex> guard(prunedLayoutMutex);
+  if (circuit->prunedWitness2SignalList == NULL) {
+    u64 *list = new u64[get_size_of_witness()];
+    for (uint i = 0; i < get_size_of_witness(); i++) {
+      list[i] = prunedSignalId(feistels, circuit->witness2SignalList[i]);
+    }
+    circuit->prunedWitness2SignalList = list;
+  }
+  return get_total_signal_no() - feistels.size()*(MIMC_FEISTEL_SIGNALS - MIMC_FEISTEL_SIZE);
+}
+
+#endif
+
 uint Circom_CalcWit::getInputSignalHashPosition(u64 h) {
   uint n = get_size_of_input_hashmap();
   uint pos = (uint)(h % (u64)n);
@@ -56,38 +175,125 @@ uint Circom_CalcWit::getInputSignalHashPosition(u64 h) {
     while (pos != inipos) {
       if (circuit->InputHashMap[pos].hash==h) return pos;
       if (circuit->InputHashMap[pos].hash==0) {
-	fprintf(stderr, "Signal not found\n");
-	assert(false);
+	throw std::runtime_error("Signal not found\n");
       }
       pos = (pos+1)%n; 
     }
-    fprintf(stderr, "Signals not found\n");
-    assert(false);
+    throw std::runtime_error("Signals not found\n");
   }
   return pos;
 }
 
 void Circom_CalcWit::tryRunCircuit(){ 
   if (inputSignalAssignedCounter == 0) {
+#ifdef WITNESS_TAPE
+    if (!WitnessTape_run(this)) run(this);
+#else
     run(this);
+#endif
+    resolveInverses();
+  }
+}
+
+void Circom_CalcWit::runParallel(Circom_TemplateFunction run, uint cIdx, std::thread &t) {
+  {
+    std::lock_guard<std::mutex> guard(numThreadMutex);
+    if (numThread < maxThread) {
+      numThread++;
+      parallelThreads.push_back(&t);
+      t = std::thread([this, run, cIdx]() {
+        std::exception_ptr error;
+        try {
+          run(cIdx, this);
+        } catch (...) {
+          error = std::current_exception();
+        }
+        std::lock_guard<std::mutex> guard(numThreadMutex);
+        if (error && !parallelError) parallelError = error;
+        numThread--;
+      });
+      return;
+    }
+  }
+  run(cIdx, this);
+}
+
+void Circom_CalcWit::joinParallel(std::thread &t) {
+  if (t.joinable()) t.join();
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> guard(numThreadMutex);
+    error = parallelError;
+    parallelError = nullptr;
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+void Circom_CalcWit::joinAllParallel() {
+  // not under the lock while joining: a thread takes it to finish
+  for (;;) {
+    std::thread *t;
+    {
+      std::lock_guard<std::mutex> guard(numThreadMutex);
+      if (parallelThreads.empty()) break;
+      t = parallelThreads.back();
+      parallelThreads.pop_back();
+    }
+    if (t->joinable()) t->join();
+  }
+  parallelError = nullptr;
+}
+
+void Circom_CalcWit::parallelFor(uint n, const std::function<void(uint)> &job) {
+  std::atomic<uint> next(0);
+  auto work = [&next, n, &job]() {
+    for (uint i = next++; i < n; i = next++) job(i);
+  };
+  std::vector<std::thread> helpers;
+  {
+    std::lock_guard<std::mutex> guard(numThreadMutex);
+    while (helpers.size() + 1 < n && numThread < maxThread) {
+      numThread++;
+      helpers.emplace_back([this, &work]() {
+        work();
+        std::lock_guard<std::mutex> guard(numThreadMutex);
+        numThread--;
+      });
+    }
+  }
+  work();
+  for (std::thread &t : helpers) t.join();
+}
+
+void Circom_CalcWit::deferInverse(PFrElement r, PFrElement a) {
+  std::lock_guard<std::mutex> guard(inverseMutex);
+  inverseDests.push_back(r);
+  inverseValues.push_back(*a);
+}
+
+void Circom_CalcWit::resolveInverses() {
+  uint n = inverseDests.size();
+  if (n == 0) return;
+  Fr_batchInv(inverseValues.data(), inverseValues.data(), n);
+  for (uint i = 0; i < n; i++) {
+    *inverseDests[i] = inverseValues[i];
   }
+  inverseDests.clear();
+  inverseValues.clear();
 }
 
 void Circom_CalcWit::setInputSignal(u64 h, uint i,  FrElement & val){
   if (inputSignalAssignedCounter == 0) {
-    fprintf(stderr, "No more signals to be assigned\n");
-    assert(false);
+    throw std::runtime_error("No more signals to be assigned\n");
   }
   uint pos = getInputSignalHashPosition(h);
   if (i >= circuit->InputHashMap[pos].signalsize) {
-    fprintf(stderr, "Input signal array access exceeds the size\n");
-    assert(false);
+    throw std::runtime_error("Input signal array access exceeds the size\n");
   }
   
   uint si = circuit->InputHashMap[pos].signalid+i;
   if (inputSignalAssigned[si-get_main_input_signal_start()]) {
-    fprintf(stderr, "Signal assigned twice: %d\n", si);
-    assert(false);
+    throw std::runtime_error("Signal assigned twice: " + std::to_string(si) + "\n");
   }
   signalValues[si] = val;
   inputSignalAssigned[si-get_main_input_signal_start()] = true;
@@ -95,16 +301,55 @@ void Circom_CalcWit::setInputSignal(u64 h, uint i,  FrElement & val){
   tryRunCircuit();
 }
 
+uint Circom_CalcWit::getInputSignalHandle(u64 h) {
+  return circuit->inputHandleByHashPos[getInputSignalHashPosition(h)];
+}
+
+uint Circom_CalcWit::getInputSignalHandleById(u64 signalid) {
+  const InputSignalInfo *begin = circuit->inputSignals;
+  const InputSignalInfo *end = begin + circuit->nInputSignals;
+  const InputSignalInfo *it = std::lower_bound(begin, end, signalid,
+    [](const InputSignalInfo &info, u64 id) { return info.signalid < id; });
+  if (it == end || it->signalid != signalid) {
+    throw std::runtime_error("Signal not found: " + std::to_string(signalid) + "\n");
+  }
+  return it - begin;
+}
+
+void Circom_CalcWit::setInputSignals(uint handle, const FrElement *vals, uint n){
+  if (handle >= circuit->nInputSignals) {
+    throw std::runtime_error("Signal not found\n");
+  }
+  if (inputSignalAssignedCounter == 0) {
+    throw std::runtime_error("No more signals to be assigned\n");
+  }
+  const InputSignalInfo &info = circuit->inputSignals[handle];
+  if (n != info.signalsize) {
+    throw std::runtime_error("Input signal array access exceeds the size\n");
+  }
+  bool *assigned = &inputSignalAssigned[info.signalid-get_main_input_signal_start()];
+  for (uint i = 0; i < n; i++) {
+    if (assigned[i]) {
+      throw std::runtime_error("Signal assigned twice: " + std::to_string(info.signalid+i) + "\n");
+    }
+  }
+  memcpy(&signalValues[info.signalid], vals, n*sizeof(FrElement));
+  memset(assigned, true, n*sizeof(bool));
+  inputSignalAssignedCounter -= n;
+  tryRunCircuit();
+}
+
 u64 Circom_CalcWit::getInputSignalSize(u64 h) {
   uint pos = getInputSignalHashPosition(h);
   return circuit->InputHashMap[pos].signalsize;
 }
 
 std::string Circom_CalcWit::getTrace(u64 id_cmp){
-  if (id_cmp == 0) return componentMemory[id_cmp].componentName;
+  const Circom_ComponentName &name = componentMemory[id_cmp].componentName;
+  std::string my_name = name.name + generate_position_array(name.dimensions, name.nDimensions, name.index);
+  if (id_cmp == 0) return my_name;
   else{
     u64 id_father = componentMemory[id_cmp].idFather;
-    std::string my_name = componentMemory[id_cmp].componentName;
 
     return Circom_CalcWit::getTrace(id_father) + "." + my_name;
   }
@@ -112,7 +357,17 @@ std::string Circom_CalcWit::getTrace(u64 id_cmp){
 
 }
 
-std::string Circom_CalcWit::generate_position_array(uint* dimensions, uint size_dimensions, uint index){
+void Circom_CalcWit::failedAssert(u64 id_cmp, uint line) {
+  std::string msg = std::string("Failed assert in template/function ") + componentMemory[id_cmp].templateName +
+    " line " + std::to_string(line) + ". Followed trace of components: " + getTrace(id_cmp);
+  if (abortOnFailedAssert) {
+    std::cout << msg << std::endl;
+    return;
+  }
+  throw Circom_FailedAssert(msg + "\n");
+}
+
+std::string Circom_CalcWit::generate_position_array(const uint* dimensions, uint size_dimensions, uint index){
   std::string positions = "";
 
   for (uint i = 0 ; i < size_dimensions; i++){
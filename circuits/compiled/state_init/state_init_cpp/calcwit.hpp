@@ -5,7 +5,10 @@
 #include <condition_variable>
 #include <functional>
 #include <atomic>
+#include <exception>
 #include <memory>
+#include <stdexcept>
+#include <vector>
 
 #include "circom.hpp"
 #include "fr.hpp"
@@ -14,6 +17,15 @@
 
 u64 fnv1a(std::string s);
 
+// Thrown by a check of the circuit that fails (see failedAssert)
+class Circom_FailedAssert : public std::runtime_error {
+public:
+  Circom_FailedAssert(std::string const &msg) : std::runtime_error(msg) {}
+};
+
+class Circom_CalcWit;
+typedef void (*Circom_TemplateFunction)(uint __cIdx, Circom_CalcWit* __ctx); 
+
 class Circom_CalcWit {
 
   bool *inputSignalAssigned;
@@ -24,9 +36,11 @@ class Circom_CalcWit {
 public:
 
   FrElement *signalValues;
+  // the size of signalValues: get_total_signal_no(), less the pruned signals
+  uint nSignals;
   Circom_Component* componentMemory;
   FrElement* circuitConstants; 
-  std::map<u32,IODefPair> templateInsId2IOSignalInfo; 
+  const IOSignalInfoMap &templateInsId2IOSignalInfo; 
   std::string* listOfTemplateMessages; 
 
   // parallelism
@@ -36,12 +50,32 @@ public:
 
   int maxThread;
 
+  // Runs the subcomponent cIdx on a thread of its own, kept in t, while
+  // fewer than maxThread of them run, and in the calling thread otherwise
+  void runParallel(Circom_TemplateFunction run, uint cIdx, std::thread &t);
+  // Waits for a subcomponent started by runParallel(), and throws what
+  // one of them threw
+  void joinParallel(std::thread &t);
+  // Calls job(i) for every i < n: the calling thread and the helpers it
+  // can start (up to maxThread) each take the next i until none is left
+  void parallelFor(uint n, const std::function<void(uint)> &job);
+
   // Functions called by the circuit
   Circom_CalcWit(Circom_Circuit *aCircuit, uint numTh = NMUTEXES);
   ~Circom_CalcWit();
 
+  // Prepares the context for a new witness, keeping its allocations
+  void reset();
+
   // Public functions
   void setInputSignal(u64 h, uint i, FrElement &val);
+  // Resolves an input once, so that it can be set as a whole array by handle
+  uint getInputSignalHandle(u64 h);
+  uint getInputSignalHandleById(u64 signalid);
+  void setInputSignals(uint handle, const FrElement *vals, uint n);
+  inline const InputSignalInfo &getInputSignalInfo(uint handle) {
+    return circuit->inputSignals[handle];
+  }
   void tryRunCircuit();
   
   u64 getInputSignalSize(u64 h);
@@ -50,20 +84,57 @@ public:
     return inputSignalAssignedCounter;
   }
   
+  // The signal of the witness element idx
+  inline u64 getWitnessSignal(uint idx) {
+#ifdef PRUNE_SIGNALS
+    return circuit->prunedWitness2SignalList[idx];
+#else
+    return circuit->witness2SignalList[idx];
+#endif
+  }
+
   inline void getWitness(uint idx, PFrElement val) {
-    Fr_copy(val, &signalValues[circuit->witness2SignalList[idx]]);
+    Fr_copy(val, &signalValues[getWitnessSignal(idx)]);
   }
 
   std::string getTrace(u64 id_cmp);
 
-  std::string generate_position_array(uint* dimensions, uint size_dimensions, uint index);
+  // A check of the circuit that failed at a line of the template of the
+  // component id_cmp: thrown as a Circom_FailedAssert with its trace, or only
+  // printed when abortOnFailedAssert is set (the assert that follows it
+  // in the generated code aborts then)
+  void failedAssert(u64 id_cmp, uint line);
+  bool abortOnFailedAssert;
+
+  // Inverts a into r later, together with the other deferred inversions
+  // (a single field inversion), once the circuit has run
+  void deferInverse(PFrElement r, PFrElement a);
+  void resolveInverses();
+
+  std::string generate_position_array(const uint* dimensions, uint size_dimensions, uint index);
 
 private:
   
   uint getInputSignalHashPosition(u64 h);
 
-};
+  void releaseComponents();
 
-typedef void (*Circom_TemplateFunction)(uint __cIdx, Circom_CalcWit* __ctx); 
+#ifdef PRUNE_SIGNALS
+  uint pruneSignals();
+#endif
+
+  u32 *initialInputCounters;
+
+  // the threads started by runParallel(): a failed check can unwind past
+  // their joinParallel(), so reset() joins the ones left
+  std::vector<std::thread *> parallelThreads;
+  std::exception_ptr parallelError;
+  void joinAllParallel();
+
+  std::mutex inverseMutex;
+  std::vector<PFrElement> inverseDests;
+  std::vector<FrElement> inverseValues;
+
+};
 
 #endif // CIRCOM_CALCWIT_H
@@ -20,6 +20,13 @@ struct __attribute__((__packed__)) HashSignalInfo {
     u64 signalsize; 
 };
 
+// a main input signal resolved at load, addressed by its handle
+struct InputSignalInfo {
+    u64 hash;
+    u32 signalid;
+    u32 signalsize;
+};
+
 struct IODef { 
     u32 offset;
     u32 len;
@@ -31,21 +38,51 @@ struct IODefPair {
     IODef* defs;
 };
 
+// io signals of the templates that have an io map, indexed by template id
+struct IOSignalInfoMap {
+  u32 size = 0;
+  IODefPair* byTemplateId = NULL;
+  u8* arena = NULL;  // holds byTemplateId and all the defs and lengths
+
+  inline const IODefPair& operator[](u32 templateId) const {
+    return byTemplateId[templateId];
+  }
+};
+
 struct Circom_Circuit {
   //  const char *P;
   HashSignalInfo* InputHashMap;
   u64* witness2SignalList;
   FrElement* circuitConstants;  
-  std::map<u32,IODefPair> templateInsId2IOSignalInfo;
+  IOSignalInfoMap templateInsId2IOSignalInfo;
+  // the main inputs in signal order, and the handle of each InputHashMap entry
+  InputSignalInfo* inputSignals = NULL;
+  u32 nInputSignals = 0;
+  u32* inputHandleByHashPos = NULL;
+  // PRUNE_SIGNALS: witness2SignalList in the pruned layout, set up by the
+  // first context
+  u64* prunedWitness2SignalList = NULL;
+  // the .dat mapping the arrays above point into, when loaded in place
+  u8* mapping = NULL;
+  size_t mappingSize = 0;
 };
 
 
+// A component name as declared: a static base name and, for a component
+// in an array, its position there. Only getTrace() builds the full string.
+struct Circom_ComponentName {
+  const char *name;
+  const uint *dimensions;
+  u32 nDimensions;
+  u32 index;
+};
+
 struct Circom_Component {
   u32 templateId;
   u64 signalStart;
   u32 inputCounter;
-  std::string templateName;
-  std::string componentName;
+  const char *templateName;
+  Circom_ComponentName componentName;
   u64 idFather; 
   u32* subcomponents = NULL;
   bool* subcomponentsParallel = NULL;
@@ -1,9 +1,11 @@
 #include "fr.hpp"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <gmp.h>
 #include <assert.h>
 #include <string>
+#include <utility>
 
 
 static mpz_t q;
@@ -13,6 +15,14 @@ static mpz_t mask;
 static size_t nBits;
 static bool initialized = false;
 
+#ifdef FR_GENERIC
+// fr.asm defines these otherwise
+FrElement Fr_q = {0, Fr_LONG, {0x43e1f593f0000001ULL,0x2833e84879b97091ULL,0xb85045b68181585dULL,0x30644e72e131a029ULL}};
+FrElement Fr_R3 = {0, Fr_LONG, {0x5e94d8e1b4bf0040ULL,0x2a489cbe1cfbb6b8ULL,0x893cc664a19fcfedULL,0x0cf8594b7fcc657cULL}};
+FrRawElement Fr_rawq = {0x43e1f593f0000001ULL,0x2833e84879b97091ULL,0xb85045b68181585dULL,0x30644e72e131a029ULL};
+FrRawElement Fr_rawR3 = {0x5e94d8e1b4bf0040ULL,0x2a489cbe1cfbb6b8ULL,0x893cc664a19fcfedULL,0x0cf8594b7fcc657cULL};
+#endif
+
 
 void Fr_toMpz(mpz_t r, PFrElement pE) {
     FrElement tmp;
@@ -143,17 +153,249 @@ void Fr_pow(PFrElement r, PFrElement a, PFrElement b) {
     mpz_clear(mr);
 }
 
-void Fr_inv(PFrElement r, PFrElement a) {
-    mpz_t ma;
-    mpz_t mr;
-    mpz_init(ma);
-    mpz_init(mr);
+/*
+Inversion by the optimized binary gcd of T. Pornin (eprint 2020/972):
+31 steps of the binary gcd are run at a time on 64-bit approximations
+of a and b, made of their low 31 bits and their top 33 bits, and then
+applied to the full values as one signed linear combination. u and v
+are divided by 2^31 modulo q along with a and b, Montgomery style, so
+that v ends up being the inverse itself.
+*/
+
+// -q^-1 mod 2^64
+static const uint64_t Fr_np = 0xc2e1f593efffffffULL;
+
+// f*x + g*y as a signed 5 limb value, for |f|, |g| <= 2^31
+static inline void rawLinComb(uint64_t r[Fr_N64+1], const FrRawElement x, int64_t f, const FrRawElement y, int64_t g) {
+    __int128 acc = 0;
+    for (int i=0; i<Fr_N64; i++) {
+        acc += (__int128)x[i]*f + (__int128)y[i]*g;
+        r[i] = (uint64_t)acc;
+        acc >>= 64;
+    }
+    r[Fr_N64] = (uint64_t)acc;
+}
 
-    Fr_toMpz(ma, a);
-    mpz_invert(mr, ma, q);
-    Fr_fromMpz(r, mr);
-    mpz_clear(ma);
-    mpz_clear(mr);
+static inline bool rawIsNeg5(const uint64_t r[Fr_N64+1]) {
+    return (int64_t)r[Fr_N64] < 0;
+}
+
+static inline void rawNeg5(uint64_t r[Fr_N64+1]) {
+    uint64_t carry = 1;
+    for (int i=0; i<=Fr_N64; i++) {
+        r[i] = ~r[i] + carry;
+        carry = carry && r[i] == 0;
+    }
+}
+
+static inline bool rawGeq(const FrRawElement a, const FrRawElement b) {
+    for (int i=Fr_N64-1; i>=0; i--) {
+        if (a[i] != b[i]) return a[i] > b[i];
+    }
+    return true;
+}
+
+// a -= b, for a >= b, without reduction
+static inline void rawSubFrom(FrRawElement a, const FrRawElement b) {
+    uint64_t borrow = 0;
+    for (int i=0; i<Fr_N64; i++) {
+        uint64_t d = a[i] - b[i] - borrow;
+        borrow = (a[i] < b[i]) || (a[i] == b[i] && borrow);
+        a[i] = d;
+    }
+}
+
+// arithmetic shift right by 31 of a 5 limb value, into 4 limbs
+static inline void rawShr31(FrRawElement r, const uint64_t t[Fr_N64+1]) {
+    for (int i=0; i<Fr_N64; i++) r[i] = (t[i] >> 31) | (t[i+1] << 33);
+}
+
+// (f*x + g*y) / 2^31 mod q, for x, y < q and |f| + |g| <= 2^31
+static inline void rawLinCombMod(FrRawElement r, const FrRawElement x, int64_t f, const FrRawElement y, int64_t g) {
+    // f*x = |f|*(q-x) mod q for a negative f, so everything stays unsigned
+    FrRawElement nx, ny;
+    const uint64_t *px = x, *py = y;
+    if (f < 0) {
+        Fr_rawCopy(nx, Fr_rawq);
+        rawSubFrom(nx, x);
+        px = nx;
+        f = -f;
+    }
+    if (g < 0) {
+        Fr_rawCopy(ny, Fr_rawq);
+        rawSubFrom(ny, y);
+        py = ny;
+        g = -g;
+    }
+    // t = |f|*x + |g|*y + k*q, with k chosen to clear the low 31 bits
+    uint64_t t[Fr_N64+1];
+    unsigned __int128 acc = 0;
+    for (int i=0; i<Fr_N64; i++) {
+        acc += (unsigned __int128)px[i]*(uint64_t)f + (unsigned __int128)py[i]*(uint64_t)g;
+        t[i] = (uint64_t)acc;
+        acc >>= 64;
+    }
+    t[Fr_N64] = (uint64_t)acc;
+    uint64_t k = (t[0]*Fr_np) & 0x7FFFFFFF;
+    acc = 0;
+    for (int i=0; i<Fr_N64; i++) {
+        acc += (unsigned __int128)Fr_rawq[i]*k + t[i];
+        t[i] = (uint64_t)acc;
+        acc >>= 64;
+    }
+    t[Fr_N64] += (uint64_t)acc;
+    // t / 2^31 < 2q
+    rawShr31(r, t);
+    if (rawGeq(r, Fr_rawq)) rawSubFrom(r, Fr_rawq);
+}
+
+// low 31 bits of a, and its 33 bits below bit n
+static inline uint64_t rawApprox(const FrRawElement a, int n) {
+    int lo = n - 33;
+    int idx = lo >> 6;
+    int sh = lo & 63;
+    uint64_t top = a[idx] >> sh;
+    if (sh && idx+1 < Fr_N64) top |= a[idx+1] << (64 - sh);
+    return (a[0] & 0x7FFFFFFF) | ((top & 0x1FFFFFFFFULL) << 31);
+}
+
+static inline int rawBitLen(const FrRawElement a) {
+    for (int i=Fr_N64-1; i>=0; i--) {
+        if (a[i]) return i*64 + 64 - __builtin_clzll(a[i]);
+    }
+    return 0;
+}
+
+// y^-1 mod q, for 0 < y < q, not in Montgomery form
+static void rawInvNormal(FrRawElement r, const FrRawElement y) {
+    FrRawElement a, b, u, v;
+    Fr_rawCopy(a, y);
+    Fr_rawCopy(b, Fr_rawq);
+    u[0] = 1; u[1] = 0; u[2] = 0; u[3] = 0;
+    v[0] = 0; v[1] = 0; v[2] = 0; v[3] = 0;
+    // at most ceil((2*254 - 1)/31) rounds; once a is 0, b is 1 and v is final
+    for (int round=0; round<17 && !Fr_rawIsZero(a); round++) {
+        FrRawElement ab;
+        for (int i=0; i<Fr_N64; i++) ab[i] = a[i] | b[i];
+        int n = rawBitLen(ab);
+        if (n < 64) n = 64;
+        uint64_t xa = rawApprox(a, n);
+        uint64_t xb = rawApprox(b, n);
+        int64_t f0 = 1, g0 = 0, f1 = 0, g1 = 1;
+        // runs of even steps are done at once (a zero xa only shifts)
+        int j = 31;
+        while (true) {
+            int z = __builtin_ctzll(xa | (1ULL << j));
+            xa >>= z;
+            f1 <<= z;
+            g1 <<= z;
+            j -= z;
+            if (j == 0) break;
+            if (xa < xb) {
+                std::swap(xa, xb);
+                std::swap(f0, f1);
+                std::swap(g0, g1);
+            }
+            xa = (xa - xb) >> 1;
+            f0 -= f1;
+            g0 -= g1;
+            f1 <<= 1;
+            g1 <<= 1;
+            j--;
+            if (j == 0) break;
+        }
+        uint64_t t[Fr_N64+1];
+        FrRawElement na;
+        rawLinComb(t, a, f0, b, g0);
+        if (rawIsNeg5(t)) {
+            rawNeg5(t);
+            f0 = -f0;
+            g0 = -g0;
+        }
+        rawShr31(na, t);
+        rawLinComb(t, a, f1, b, g1);
+        if (rawIsNeg5(t)) {
+            rawNeg5(t);
+            f1 = -f1;
+            g1 = -g1;
+        }
+        rawShr31(b, t);
+        Fr_rawCopy(a, na);
+        FrRawElement nu;
+        rawLinCombMod(nu, u, f0, v, g0);
+        rawLinCombMod(v, u, f1, v, g1);
+        Fr_rawCopy(u, nu);
+    }
+    Fr_rawCopy(r, v);
+}
+
+void Fr_rawInv(FrRawElement pRawResult, const FrRawElement pRawA) {
+    if (Fr_rawIsZero(pRawA)) {
+        for (int i=0; i<Fr_N64; i++) pRawResult[i] = 0;
+        return;
+    }
+    // (aR)^-1 * R^3 / R = a^-1 R
+    FrRawElement tmp;
+    rawInvNormal(tmp, pRawA);
+    Fr_rawMMul(pRawResult, tmp, Fr_rawR3);
+}
+
+// Montgomery's trick: one inversion and 3(n-1) multiplications
+void Fr_rawBatchInv(FrRawElement *pRawResult, const FrRawElement *pRawA, int n) {
+    if (n <= 0) return;
+    // prefix[i] is the product of the non zero a[0..i]
+    FrRawElement *prefix = new FrRawElement[n];
+    FrRawElement acc = {1, 0, 0, 0};
+    Fr_rawToMontgomery(acc, acc);
+    for (int i=0; i<n; i++) {
+        if (!Fr_rawIsZero(pRawA[i])) Fr_rawMMul(acc, acc, pRawA[i]);
+        Fr_rawCopy(prefix[i], acc);
+    }
+    Fr_rawInv(acc, acc);
+    for (int i=n-1; i>=0; i--) {
+        if (Fr_rawIsZero(pRawA[i])) {
+            for (int j=0; j<Fr_N64; j++) pRawResult[i][j] = 0;
+            continue;
+        }
+        FrRawElement a;
+        Fr_rawCopy(a, pRawA[i]);
+        if (i > 0) {
+            Fr_rawMMul(pRawResult[i], acc, prefix[i-1]);
+        } else {
+            Fr_rawCopy(pRawResult[i], acc);
+        }
+        Fr_rawMMul(acc, acc, a);
+    }
+    delete [] prefix;
+}
+
+void Fr_batchInv(PFrElement r, PFrElement a, int n) {
+    // the values go through this aligned buffer: longVal is a packed member
+    FrRawElement *values = new FrRawElement[n];
+    for (int i=0; i<n; i++) {
+        FrElement m;
+        Fr_toMontgomery(&m, &a[i]);
+        memcpy(values[i], m.longVal, sizeof(FrRawElement));
+    }
+    Fr_rawBatchInv(values, values, n);
+    for (int i=0; i<n; i++) {
+        r[i].shortVal = 0;
+        r[i].type = Fr_LONGMONTGOMERY;
+        memcpy(r[i].longVal, values[i], sizeof(FrRawElement));
+    }
+    delete [] values;
+}
+
+void Fr_inv(PFrElement r, PFrElement a) {
+    FrElement m;
+    Fr_toMontgomery(&m, a);
+    // longVal is a packed member: inverted through aligned copies
+    FrRawElement v, inv;
+    memcpy(v, m.longVal, sizeof(FrRawElement));
+    Fr_rawInv(inv, v);
+    r->shortVal = 0;
+    r->type = Fr_LONGMONTGOMERY;
+    memcpy(r->longVal, inv, sizeof(FrRawElement));
 }
 
 void Fr_div(PFrElement r, PFrElement a, PFrElement b) {
@@ -233,17 +475,7 @@ std::string RawFr::toString(const Element &a, uint32_t radix) {
 }
 
 void RawFr::inv(Element &r, const Element &a) {
-    mpz_t mr;
-    mpz_init(mr);
-    mpz_import(mr, Fr_N64, -1, 8, -1, 0, (const void *)(a.v));
-    mpz_invert(mr, mr, q);
-
-
-    for (int i=0; i<Fr_N64; i++) r.v[i] = 0;
-    mpz_export((void *)(r.v), NULL, -1, 8, -1, 0, mr);
-
-    Fr_rawMMul(r.v, r.v,Fr_rawR3);
-    mpz_clear(mr);
+    Fr_rawInv(r.v, a.v);
 }
 
 void RawFr::div(Element &r, const Element &a, const Element &b) {
@@ -0,0 +1,514 @@
+#ifndef __FR_GENERIC_H
+#define __FR_GENERIC_H
+
+// Portable C++ implementation of the Fr_* / Fr_raw* ABI exported by fr.asm,
+// selected with make FR_GENERIC=1. It is included by fr.hpp, and every
+// function is inline so that the compiler can fuse the field operations of
+// the generated *_run code.
+
+#include <stdint.h>
+#include <string.h>
+
+typedef unsigned __int128 Fr_u128;
+
+static const uint64_t Fr_genq[Fr_N64] = {0x43e1f593f0000001ULL,0x2833e84879b97091ULL,0xb85045b68181585dULL,0x30644e72e131a029ULL};
+static const uint64_t Fr_genHalf[Fr_N64] = {0xa1f0fac9f8000000ULL,0x9419f4243cdcb848ULL,0xdc2822db40c0ac2eULL,0x183227397098d014ULL};
+static const uint64_t Fr_genR2[Fr_N64] = {0x1bb8e645ae216da7ULL,0x53fe3ab1e35c59e3ULL,0x8c49833d53bb8085ULL,0x0216d0b17f4e44a5ULL};
+static const uint64_t Fr_genOne[Fr_N64] = {1,0,0,0};
+static const uint64_t Fr_genLboMask = 0x3fffffffffffffffULL;
+static const uint64_t Fr_genNp = 0xc2e1f593efffffffULL;
+
+// raw helpers
+
+static inline int Fr_rawCmp(const uint64_t *a, const uint64_t *b) {
+    for (int i=Fr_N64-1; i>=0; i--) {
+        if (a[i] != b[i]) return a[i] > b[i] ? 1 : -1;
+    }
+    return 0;
+}
+
+static inline void Fr_rawSubq(uint64_t *r) {
+    Fr_u128 t;
+    uint64_t borrow = 0;
+    for (int i=0; i<Fr_N64; i++) {
+        t = (Fr_u128)r[i] - Fr_genq[i] - borrow;
+        r[i] = (uint64_t)t;
+        borrow = (uint64_t)(t >> 64) & 1;
+    }
+}
+
+static inline void Fr_rawReduce(uint64_t *r) {
+    if (Fr_rawCmp(r, Fr_genq) >= 0) Fr_rawSubq(r);
+}
+
+extern "C" inline void Fr_rawCopy(FrRawElement pRawResult, const FrRawElement pRawA) {
+    memcpy(pRawResult, pRawA, sizeof(FrRawElement));
+}
+
+extern "C" inline void Fr_rawSwap(FrRawElement pRawResult, FrRawElement pRawA) {
+    FrRawElement tmp;
+    memcpy(tmp, pRawResult, sizeof(FrRawElement));
+    memcpy(pRawResult, pRawA, sizeof(FrRawElement));
+    memcpy(pRawA, tmp, sizeof(FrRawElement));
+}
+
+extern "C" inline void Fr_rawAdd(FrRawElement pRawResult, const FrRawElement pRawA, const FrRawElement pRawB) {
+    Fr_u128 t;
+    uint64_t carry = 0;
+    for (int i=0; i<Fr_N64; i++) {
+        t = (Fr_u128)pRawA[i] + pRawB[i] + carry;
+        pRawResult[i] = (uint64_t)t;
+        carry = (uint64_t)(t >> 64);
+    }
+    // q < 2^254 so the sum never carries out of the top limb
+    Fr_rawReduce(pRawResult);
+}
+
+extern "C" inline void Fr_rawSub(FrRawElement pRawResult, const FrRawElement pRawA, const FrRawElement pRawB) {
+    Fr_u128 t;
+    uint64_t borrow = 0;
+    for (int i=0; i<Fr_N64; i++) {
+        t = (Fr_u128)pRawA[i] - pRawB[i] - borrow;
+        pRawResult[i] = (uint64_t)t;
+        borrow = (uint64_t)(t >> 64) & 1;
+    }
+    if (borrow) {
+        uint64_t carry = 0;
+        for (int i=0; i<Fr_N64; i++) {
+            t = (Fr_u128)pRawResult[i] + Fr_genq[i] + carry;
+            pRawResult[i] = (uint64_t)t;
+            carry = (uint64_t)(t >> 64);
+        }
+    }
+}
+
+extern "C" inline int Fr_rawIsZero(const FrRawElement pRawB) {
+    return (pRawB[0] | pRawB[1] | pRawB[2] | pRawB[3]) == 0;
+}
+
+extern "C" inline int Fr_rawIsEq(const FrRawElement pRawA, const FrRawElement pRawB) {
+    return ((pRawA[0]^pRawB[0]) | (pRawA[1]^pRawB[1]) | (pRawA[2]^pRawB[2]) | (pRawA[3]^pRawB[3])) == 0;
+}
+
+extern "C" inline void Fr_rawNeg(FrRawElement pRawResult, const FrRawElement pRawA) {
+    if (Fr_rawIsZero(pRawA)) {
+        memset(pRawResult, 0, sizeof(FrRawElement));
+    } else {
+        Fr_rawSub(pRawResult, Fr_genq, pRawA);
+    }
+}
+
+// Montgomery multiplication, CIOS over 4 64-bit limbs
+extern "C" inline void Fr_rawMMul(FrRawElement pRawResult, const FrRawElement pRawA, const FrRawElement pRawB) {
+    uint64_t t[Fr_N64+2] = {0, 0, 0, 0, 0, 0};
+    for (int i=0; i<Fr_N64; i++) {
+        Fr_u128 s;
+        uint64_t carry = 0;
+        for (int j=0; j<Fr_N64; j++) {
+            s = (Fr_u128)pRawA[j] * pRawB[i] + t[j] + carry;
+            t[j] = (uint64_t)s;
+            carry = (uint64_t)(s >> 64);
+        }
+        s = (Fr_u128)t[Fr_N64] + carry;
+        t[Fr_N64] = (uint64_t)s;
+        t[Fr_N64+1] = (uint64_t)(s >> 64);
+
+        uint64_t m = t[0] * Fr_genNp;
+        s = (Fr_u128)m * Fr_genq[0] + t[0];
+        carry = (uint64_t)(s >> 64);
+        for (int j=1; j<Fr_N64; j++) {
+            s = (Fr_u128)m * Fr_genq[j] + t[j] + carry;
+            t[j-1] = (uint64_t)s;
+            carry = (uint64_t)(s >> 64);
+        }
+        s = (Fr_u128)t[Fr_N64] + carry;
+        t[Fr_N64-1] = (uint64_t)s;
+        t[Fr_N64] = t[Fr_N64+1] + (uint64_t)(s >> 64);
+    }
+    memcpy(pRawResult, t, sizeof(FrRawElement));
+    Fr_rawReduce(pRawResult);
+}
+
+extern "C" inline void Fr_rawMSquare(FrRawElement pRawResult, const FrRawElement pRawA) {
+    Fr_rawMMul(pRawResult, pRawA, pRawA);
+}
+
+extern "C" inline void Fr_rawMMul1(FrRawElement pRawResult, const FrRawElement pRawA, uint64_t pRawB) {
+    const FrRawElement b = {pRawB, 0, 0, 0};
+    Fr_rawMMul(pRawResult, pRawA, b);
+}
+
+extern "C" inline void Fr_rawToMontgomery(FrRawElement pRawResult, const FrRawElement &pRawA) {
+    Fr_rawMMul(pRawResult, pRawA, Fr_genR2);
+}
+
+extern "C" inline void Fr_rawFromMontgomery(FrRawElement pRawResult, const FrRawElement &pRawA) {
+    Fr_rawMMul(pRawResult, pRawA, Fr_genOne);
+}
+
+// element helpers
+
+static inline bool Fr_isLong(const FrElement *a) { return a->type & Fr_LONG; }
+static inline bool Fr_isLongMontgomery(const FrElement *a) { return (a->type & Fr_LONGMONTGOMERY) == Fr_LONGMONTGOMERY; }
+
+// FrElement is packed: longVal is copied in and out, never passed by address
+static inline void Fr_loadLong(FrRawElement r, const FrElement *a) {
+    memcpy(r, a->longVal, sizeof(FrRawElement));
+}
+
+static inline void Fr_storeLong(PFrElement r, const FrRawElement v) {
+    memcpy(r->longVal, v, sizeof(FrRawElement));
+}
+
+static inline void Fr_setShort(PFrElement r, int64_t v) {
+    r->shortVal = (int32_t)v;
+    r->type = Fr_SHORT;
+}
+
+// Long normal representation of a signed 64-bit integer (negatives wrap around q)
+static inline void Fr_rawFromInt(FrRawElement r, int64_t v) {
+    if (v >= 0) {
+        r[0] = (uint64_t)v; r[1] = 0; r[2] = 0; r[3] = 0;
+    } else {
+        const FrRawElement a = {(uint64_t)(-(v+1)) + 1, 0, 0, 0};
+        Fr_rawSub(r, Fr_genq, a);
+    }
+}
+
+static inline void Fr_setInt64(PFrElement r, int64_t v) {
+    if (v >= INT32_MIN && v <= INT32_MAX) {
+        Fr_setShort(r, v);
+    } else {
+        FrRawElement t;
+        Fr_rawFromInt(t, v);
+        Fr_storeLong(r, t);
+        r->shortVal = 0;
+        r->type = Fr_LONG;
+    }
+}
+
+static inline void Fr_getLongNormal(FrRawElement r, const FrElement *a) {
+    if (!Fr_isLong(a)) {
+        Fr_rawFromInt(r, a->shortVal);
+    } else if (Fr_isLongMontgomery(a)) {
+        FrRawElement m;
+        Fr_loadLong(m, a);
+        Fr_rawFromMontgomery(r, m);
+    } else {
+        Fr_loadLong(r, a);
+    }
+}
+
+static inline void Fr_getMontgomery(FrRawElement r, const FrElement *a) {
+    if (!Fr_isLong(a)) {
+        if (a->shortVal >= 0) {
+            Fr_rawMMul1(r, Fr_genR2, (uint64_t)a->shortVal);
+        } else {
+            Fr_rawMMul1(r, Fr_genR2, (uint64_t)(-(int64_t)a->shortVal));
+            Fr_rawNeg(r, r);
+        }
+    } else if (Fr_isLongMontgomery(a)) {
+        Fr_loadLong(r, a);
+    } else {
+        FrRawElement n;
+        Fr_loadLong(n, a);
+        Fr_rawToMontgomery(r, n);
+    }
+}
+
+// Brings a and b to a common long domain; returns true when it is Montgomery
+static inline bool Fr_getCommon(FrRawElement ra, FrRawElement rb, const FrElement *a, const FrElement *b) {
+    if (Fr_isLongMontgomery(a) || Fr_isLongMontgomery(b)) {
+        Fr_getMontgomery(ra, a);
+        Fr_getMontgomery(rb, b);
+        return true;
+    }
+    Fr_getLongNormal(ra, a);
+    Fr_getLongNormal(rb, b);
+    return false;
+}
+
+static inline void Fr_setLong(PFrElement r, bool montgomery) {
+    r->shortVal = 0;
+    r->type = montgomery ? Fr_LONGMONTGOMERY : Fr_LONG;
+}
+
+static inline bool Fr_rawIsNegative(const FrRawElement a) {
+    return Fr_rawCmp(a, Fr_genHalf) > 0;
+}
+
+// element ABI
+
+extern "C" inline void Fr_copy(PFrElement r, PFrElement a) {
+    *r = *a;
+}
+
+extern "C" inline void Fr_copyn(PFrElement r, PFrElement a, int n) {
+    memcpy(r, a, n*sizeof(FrElement));
+}
+
+extern "C" inline void Fr_toNormal(PFrElement r, PFrElement a) {
+    if (Fr_isLongMontgomery(a)) {
+        FrRawElement t;
+        Fr_getLongNormal(t, a);
+        Fr_storeLong(r, t);
+        Fr_setLong(r, false);
+    } else {
+        *r = *a;
+    }
+}
+
+extern "C" inline void Fr_toLongNormal(PFrElement r, PFrElement a) {
+    if (!Fr_isLong(a) || Fr_isLongMontgomery(a)) {
+        FrRawElement t;
+        Fr_getLongNormal(t, a);
+        Fr_storeLong(r, t);
+        Fr_setLong(r, false);
+    } else {
+        *r = *a;
+    }
+}
+
+extern "C" inline void Fr_toMontgomery(PFrElement r, PFrElement a) {
+    if (a->type & Fr_SHORTMONTGOMERY) {
+        *r = *a;
+    } else if (Fr_isLong(a)) {
+        FrRawElement t;
+        Fr_getMontgomery(t, a);
+        Fr_storeLong(r, t);
+        Fr_setLong(r, true);
+    } else {
+        // short Montgomery: keeps shortVal, caches the Montgomery form
+        FrRawElement t;
+        Fr_getMontgomery(t, a);
+        Fr_storeLong(r, t);
+        r->shortVal = a->shortVal;
+        r->type = Fr_SHORTMONTGOMERY;
+    }
+}
+
+extern "C" inline void Fr_add(PFrElement r, PFrElement a, PFrElement b) {
+    if (!Fr_isLong(a) && !Fr_isLong(b)) {
+        Fr_setInt64(r, (int64_t)a->shortVal + (int64_t)b->shortVal);
+    } else {
+        FrRawElement ra, rb, t;
+        bool m = Fr_getCommon(ra, rb, a, b);
+        Fr_rawAdd(t, ra, rb);
+        Fr_storeLong(r, t);
+        Fr_setLong(r, m);
+    }
+}
+
+extern "C" inline void Fr_sub(PFrElement r, PFrElement a, PFrElement b) {
+    if (!Fr_isLong(a) && !Fr_isLong(b)) {
+        Fr_setInt64(r, (int64_t)a->shortVal - (int64_t)b->shortVal);
+    } else {
+        FrRawElement ra, rb, t;
+        bool m = Fr_getCommon(ra, rb, a, b);
+        Fr_rawSub(t, ra, rb);
+        Fr_storeLong(r, t);
+        Fr_setLong(r, m);
+    }
+}
+
+extern "C" inline void Fr_neg(PFrElement r, PFrElement a) {
+    if (!Fr_isLong(a)) {
+        Fr_setInt64(r, -(int64_t)a->shortVal);
+    } else {
+        bool m = Fr_isLongMontgomery(a);
+        FrRawElement ra, t;
+        Fr_loadLong(ra, a);
+        Fr_rawNeg(t, ra);
+        Fr_storeLong(r, t);
+        Fr_setLong(r, m);
+    }
+}
+
+extern "C" inline void Fr_mul(PFrElement r, PFrElement a, PFrElement b) {
+    if (!Fr_isLong(a) && !Fr_isLong(b)) {
+        Fr_setInt64(r, (int64_t)a->shortVal * (int64_t)b->shortVal);
+    } else {
+        // (aR)(bR)/R = abR keeps the product in Montgomery form
+        FrRawElement ra, rb, t;
+        Fr_getMontgomery(ra, a);
+        Fr_getMontgomery(rb, b);
+        Fr_rawMMul(t, ra, rb);
+        Fr_storeLong(r, t);
+        Fr_setLong(r, true);
+    }
+}
+
+extern "C" inline void Fr_square(PFrElement r, PFrElement a) {
+    Fr_mul(r, a, a);
+}
+
+extern "C" inline int Fr_isTrue(PFrElement pE) {
+    if (!Fr_isLong(pE)) return pE->shortVal != 0;
+    FrRawElement a;
+    Fr_loadLong(a, pE);
+    return !Fr_rawIsZero(a);
+}
+
+extern "C" inline int Fr_toInt(PFrElement pE) {
+    if (!Fr_isLong(pE)) return pE->shortVal;
+    FrRawElement a;
+    Fr_getLongNormal(a, pE);
+    if (a[1] == 0 && a[2] == 0 && a[3] == 0 && (a[0] >> 31) == 0) return (int)a[0];
+    FrRawElement n;
+    Fr_rawSub(n, Fr_genq, a);
+    if (n[1] == 0 && n[2] == 0 && n[3] == 0 && n[0] <= 0x80000000ULL) return (int)(-(int64_t)n[0]);
+    Fr_fail();
+    return 0;
+}
+
+static inline int Fr_req(PFrElement a, PFrElement b) {
+    if (!Fr_isLong(a) && !Fr_isLong(b)) return a->shortVal == b->shortVal;
+    FrRawElement ra, rb;
+    Fr_getCommon(ra, rb, a, b);
+    return Fr_rawIsEq(ra, rb);
+}
+
+// Signed comparison: elements above (q-1)/2 are treated as negative
+static inline int Fr_rlt(PFrElement a, PFrElement b) {
+    if (!Fr_isLong(a) && !Fr_isLong(b)) return a->shortVal < b->shortVal;
+    FrRawElement ra, rb;
+    Fr_getLongNormal(ra, a);
+    Fr_getLongNormal(rb, b);
+    bool na = Fr_rawIsNegative(ra);
+    bool nb = Fr_rawIsNegative(rb);
+    if (na != nb) return na;
+    return Fr_rawCmp(ra, rb) < 0;
+}
+
+extern "C" inline void Fr_eq(PFrElement r, PFrElement a, PFrElement b) { Fr_setShort(r, Fr_req(a, b)); }
+extern "C" inline void Fr_neq(PFrElement r, PFrElement a, PFrElement b) { Fr_setShort(r, !Fr_req(a, b)); }
+extern "C" inline void Fr_lt(PFrElement r, PFrElement a, PFrElement b) { Fr_setShort(r, Fr_rlt(a, b)); }
+extern "C" inline void Fr_gt(PFrElement r, PFrElement a, PFrElement b) { Fr_setShort(r, Fr_rlt(b, a)); }
+extern "C" inline void Fr_leq(PFrElement r, PFrElement a, PFrElement b) { Fr_setShort(r, !Fr_rlt(b, a)); }
+extern "C" inline void Fr_geq(PFrElement r, PFrElement a, PFrElement b) { Fr_setShort(r, !Fr_rlt(a, b)); }
+extern "C" inline void Fr_land(PFrElement r, PFrElement a, PFrElement b) { Fr_setShort(r, Fr_isTrue(a) && Fr_isTrue(b)); }
+extern "C" inline void Fr_lor(PFrElement r, PFrElement a, PFrElement b) { Fr_setShort(r, Fr_isTrue(a) || Fr_isTrue(b)); }
+extern "C" inline void Fr_lnot(PFrElement r, PFrElement a) { Fr_setShort(r, !Fr_isTrue(a)); }
+
+// Bitwise results keep the low 254 bits and are reduced once, as in fr.asm
+static inline void Fr_setBitResult(PFrElement r, FrRawElement v) {
+    v[3] &= Fr_genLboMask;
+    Fr_rawReduce(v);
+    Fr_storeLong(r, v);
+    Fr_setLong(r, false);
+}
+
+extern "C" inline void Fr_band(PFrElement r, PFrElement a, PFrElement b) {
+    if (!Fr_isLong(a) && !Fr_isLong(b) && a->shortVal >= 0 && b->shortVal >= 0) {
+        Fr_setShort(r, a->shortVal & b->shortVal);
+        return;
+    }
+    FrRawElement ra, rb;
+    Fr_getLongNormal(ra, a);
+    Fr_getLongNormal(rb, b);
+    for (int i=0; i<Fr_N64; i++) ra[i] &= rb[i];
+    Fr_setBitResult(r, ra);
+}
+
+extern "C" inline void Fr_bor(PFrElement r, PFrElement a, PFrElement b) {
+    if (!Fr_isLong(a) && !Fr_isLong(b) && a->shortVal >= 0 && b->shortVal >= 0) {
+        Fr_setShort(r, a->shortVal | b->shortVal);
+        return;
+    }
+    FrRawElement ra, rb;
+    Fr_getLongNormal(ra, a);
+    Fr_getLongNormal(rb, b);
+    for (int i=0; i<Fr_N64; i++) ra[i] |= rb[i];
+    Fr_setBitResult(r, ra);
+}
+
+extern "C" inline void Fr_bxor(PFrElement r, PFrElement a, PFrElement b) {
+    if (!Fr_isLong(a) && !Fr_isLong(b) && a->shortVal >= 0 && b->shortVal >= 0) {
+        Fr_setShort(r, a->shortVal ^ b->shortVal);
+        return;
+    }
+    FrRawElement ra, rb;
+    Fr_getLongNormal(ra, a);
+    Fr_getLongNormal(rb, b);
+    for (int i=0; i<Fr_N64; i++) ra[i] ^= rb[i];
+    Fr_setBitResult(r, ra);
+}
+
+extern "C" inline void Fr_bnot(PFrElement r, PFrElement a) {
+    FrRawElement ra;
+    Fr_getLongNormal(ra, a);
+    for (int i=0; i<Fr_N64; i++) ra[i] = ~ra[i];
+    Fr_setBitResult(r, ra);
+}
+
+static inline void Fr_rawShr(FrRawElement r, const FrRawElement a, uint32_t n) {
+    uint32_t w = n >> 6, s = n & 0x3F;
+    for (int i=0; i<Fr_N64; i++) {
+        uint64_t lo = (i+w < Fr_N64) ? a[i+w] : 0;
+        uint64_t hi = (i+w+1 < Fr_N64) ? a[i+w+1] : 0;
+        r[i] = s ? ((lo >> s) | (hi << (64-s))) : lo;
+    }
+}
+
+static inline void Fr_rawShl(FrRawElement r, const FrRawElement a, uint32_t n) {
+    int w = n >> 6, s = n & 0x3F;
+    for (int i=Fr_N64-1; i>=0; i--) {
+        uint64_t hi = (i-w >= 0) ? a[i-w] : 0;
+        uint64_t lo = (i-w-1 >= 0) ? a[i-w-1] : 0;
+        r[i] = s ? ((hi << s) | (lo >> (64-s))) : hi;
+    }
+}
+
+static inline void Fr_doShr(PFrElement r, PFrElement a, uint32_t n) {
+    if (!Fr_isLong(a) && a->shortVal >= 0) {
+        Fr_setShort(r, n >= 31 ? 0 : (a->shortVal >> n));
+        return;
+    }
+    FrRawElement ra, t;
+    Fr_getLongNormal(ra, a);
+    Fr_rawShr(t, ra, n);
+    Fr_storeLong(r, t);
+    Fr_setLong(r, false);
+}
+
+static inline void Fr_doShl(PFrElement r, PFrElement a, uint32_t n) {
+    if (!Fr_isLong(a) && a->shortVal >= 0 && n < 31) {
+        int64_t v = (int64_t)a->shortVal << n;
+        if ((v >> 31) == 0) {
+            Fr_setShort(r, v);
+            return;
+        }
+    }
+    FrRawElement ra, rs;
+    Fr_getLongNormal(ra, a);
+    Fr_rawShl(rs, ra, n);
+    Fr_setBitResult(r, rs);
+}
+
+// Shift amounts are signed: a negative (i.e. > q/2) amount shifts the other way
+static inline void Fr_shift(PFrElement r, PFrElement a, PFrElement b, bool right) {
+    if (!Fr_isLong(b)) {
+        int32_t n = b->shortVal;
+        if (n < 0) { n = -n; right = !right; }
+        if (n >= 254) { Fr_setShort(r, 0); return; }
+        right ? Fr_doShr(r, a, n) : Fr_doShl(r, a, n);
+        return;
+    }
+    FrRawElement rb, nb;
+    Fr_getLongNormal(rb, b);
+    if (rb[1] == 0 && rb[2] == 0 && rb[3] == 0 && rb[0] < 254) {
+        right ? Fr_doShr(r, a, (uint32_t)rb[0]) : Fr_doShl(r, a, (uint32_t)rb[0]);
+        return;
+    }
+    Fr_rawSub(nb, Fr_genq, rb);
+    if (nb[1] == 0 && nb[2] == 0 && nb[3] == 0 && nb[0] < 254) {
+        right ? Fr_doShl(r, a, (uint32_t)nb[0]) : Fr_doShr(r, a, (uint32_t)nb[0]);
+        return;
+    }
+    Fr_setShort(r, 0);
+}
+
+extern "C" inline void Fr_shr(PFrElement r, PFrElement a, PFrElement b) { Fr_shift(r, a, b, true); }
+extern "C" inline void Fr_shl(PFrElement r, PFrElement a, PFrElement b) { Fr_shift(r, a, b, false); }
+
+#endif // __FR_GENERIC_H
@@ -6,11 +6,18 @@
 #include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
-#include <nlohmann/json.hpp>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/time.h>
 #include <vector>
 #include <chrono>
-
-using json = nlohmann::json;
+#include <functional>
+#include <algorithm>
+#include <dirent.h>
+#include <deque>
+#include <thread>
+#include <assert.h>
 
 #include "calcwit.hpp"
 #include "circom.hpp"
@@ -19,7 +26,137 @@ using json = nlohmann::json;
 #define handle_error(msg) \
            do { perror(msg); exit(EXIT_FAILURE); } while (0)
 
-Circom_Circuit* loadCircuit(std::string const &datFileName) {
+// Checks the type of an element read from a file and that a long one is reduced
+bool isValidFrElement(const FrElement &e) {
+    bool validType = e.type == Fr_SHORT || e.type == Fr_SHORTMONTGOMERY ||
+                     e.type == Fr_LONG || e.type == Fr_LONGMONTGOMERY;
+    if (!validType) return false;
+    if (e.type == Fr_SHORT) return true;
+    for (int j = Fr_N64 - 1; j >= 0; j--) {
+      if (e.longVal[j] != Fr_rawq[j]) return e.longVal[j] < Fr_rawq[j];
+    }
+    return false;
+}
+
+void validateCircuit(Circom_Circuit *circuit) {
+    for (uint i = 0; i < get_size_of_input_hashmap(); i++) {
+      HashSignalInfo &info = circuit->InputHashMap[i];
+      if (info.hash != 0 && (info.signalid < get_main_input_signal_start() ||
+                             info.signalid + info.signalsize > get_main_input_signal_start() + get_main_input_signal_no())) {
+        throw std::runtime_error(".dat file corrupted: input signal out of range\n");
+      }
+    }
+    for (uint i = 0; i < get_size_of_witness(); i++) {
+      if (circuit->witness2SignalList[i] >= get_total_signal_no()) {
+        throw std::runtime_error(".dat file corrupted: witness signal out of range\n");
+      }
+    }
+    for (uint i = 0; i < get_size_of_constants(); i++) {
+      if (!isValidFrElement(circuit->circuitConstants[i])) {
+        throw std::runtime_error(".dat file corrupted: invalid constant " + std::to_string(i) + "\n");
+      }
+    }
+}
+
+// The generated code reads the constants in place, so any the .dat holds in
+// normal form are brought to Montgomery form once here rather than in every
+// operation that uses them. Short constants keep their short value.
+void constantsToMontgomery(Circom_Circuit *circuit, bool inPlace) {
+    uint n = get_size_of_constants();
+    uint i = 0;
+    while (i < n && (circuit->circuitConstants[i].type & Fr_SHORTMONTGOMERY)) i++;
+    if (i == n) return;
+    if (inPlace) {
+      // the mapping is read only
+      FrElement *constants = new FrElement[n];
+      memcpy((void *)constants, (void *)circuit->circuitConstants, n*sizeof(FrElement));
+      circuit->circuitConstants = constants;
+    }
+    for (; i < n; i++) {
+      Fr_toMontgomery(&circuit->circuitConstants[i], &circuit->circuitConstants[i]);
+    }
+}
+
+// Builds the resolved input table: the hash map entries in signal order,
+// so that an input is looked up once per document instead of once per element
+void resolveInputSignals(Circom_Circuit *circuit) {
+    uint n = get_size_of_input_hashmap();
+    std::vector<uint> positions;
+    for (uint i = 0; i < n; i++) {
+      if (circuit->InputHashMap[i].hash != 0) positions.push_back(i);
+    }
+    std::sort(positions.begin(), positions.end(), [circuit](uint a, uint b) {
+      return circuit->InputHashMap[a].signalid < circuit->InputHashMap[b].signalid;
+    });
+    circuit->nInputSignals = positions.size();
+    circuit->inputSignals = new InputSignalInfo[positions.size()];
+    circuit->inputHandleByHashPos = new u32[n];
+    for (uint i = 0; i < n; i++) {
+      circuit->inputHandleByHashPos[i] = positions.size();
+    }
+    for (uint k = 0; k < positions.size(); k++) {
+      HashSignalInfo &info = circuit->InputHashMap[positions[k]];
+      circuit->inputSignals[k].hash = info.hash;
+      circuit->inputSignals[k].signalid = info.signalid;
+      circuit->inputSignals[k].signalsize = info.signalsize;
+      circuit->inputHandleByHashPos[positions[k]] = k;
+    }
+}
+
+/*
+Builds the io map in a single pass over its .dat section: nTemplates
+template ids, each followed in data by its number of io signals and,
+for every signal, its offset, its number of dimensions and their
+lengths. The defs and lengths of all templates are laid out in one
+arena, whose size is bounded by the section size.
+*/
+void loadIOMap(IOSignalInfoMap &iomap, const u32 *index, u32 nTemplates, const u32 *data, u32 nWords) {
+    u32 maxTemplateId = 0;
+    for (u32 i = 0; i < nTemplates; i++) {
+      maxTemplateId = std::max(maxTemplateId, index[i]);
+    }
+    iomap.size = maxTemplateId + 1;
+    // every def takes at least two words of data
+    size_t arenaSize = iomap.size*sizeof(IODefPair) + (nWords/2)*sizeof(IODef) + nWords*sizeof(u32);
+    iomap.arena = new u8[arenaSize]();
+    iomap.byTemplateId = (IODefPair *)iomap.arena;
+    IODef *defs = (IODef *)(iomap.byTemplateId + iomap.size);
+    u32 *lengths = (u32 *)(defs + nWords/2);
+
+    const u32 *pu32 = data;
+    const u32 *end = data + nWords;
+    for (u32 i = 0; i < nTemplates; i++) {
+      if (pu32 >= end) {
+        throw std::runtime_error(".dat file corrupted: invalid io map\n");
+      }
+      u32 n = *pu32;
+      pu32 += 1;
+      IODefPair &p = iomap.byTemplateId[index[i]];
+      p.len = n;
+      p.defs = defs;
+      for (u32 j = 0; j < n; j++) {
+        if (end - pu32 < 2 || (u32)(end - pu32 - 2) < *(pu32+1)) {
+          throw std::runtime_error(".dat file corrupted: invalid io map\n");
+        }
+        u32 len = *(pu32+1);
+        defs->offset = *pu32;
+        defs->len = len;
+        defs->lengths = lengths;
+        memcpy((void *)lengths, (void *)(pu32+2), len*sizeof(u32));
+        lengths += len;
+        defs++;
+        pu32 += len + 2;
+      }
+    }
+}
+
+/*
+Loads the circuit description from its .dat file. With inPlace, the
+file stays mapped and the input hashmap, the witness list and the
+constants point straight into the mapping instead of being copied, so
+loading is close to free and processes on a host share the page cache.
+*/
+Circom_Circuit* loadCircuit(std::string const &datFileName, bool inPlace = true) {
     Circom_Circuit *circuit = new Circom_Circuit;
 
     int fd;
@@ -35,62 +172,56 @@ Circom_Circuit* loadCircuit(std::string const &datFileName) {
         throw std::system_error(errno, std::generic_category(), "fstat");
     }
 
-    u8* bdata = (u8*)mmap(NULL, sb.st_size, PROT_READ , MAP_PRIVATE, fd, 0);
+    u8* bdata = (u8*)mmap(NULL, sb.st_size, PROT_READ , inPlace ? MAP_SHARED : MAP_PRIVATE, fd, 0);
     close(fd);
+    if (bdata == MAP_FAILED) {
+        throw std::system_error(errno, std::generic_category(), "mmap");
+    }
 
-    circuit->InputHashMap = new HashSignalInfo[get_size_of_input_hashmap()];
-    uint dsize = get_size_of_input_hashmap()*sizeof(HashSignalInfo);
-    memcpy((void *)(circuit->InputHashMap), (void *)bdata, dsize);
+    uint hashmapSize = get_size_of_input_hashmap()*sizeof(HashSignalInfo);
+    uint witnessSize = get_size_of_witness()*sizeof(u64);
+    uint constantsSize = get_size_of_constants()*sizeof(FrElement);
+    if ((u64)sb.st_size < (u64)hashmapSize + witnessSize + constantsSize) {
+        throw std::runtime_error(".dat file too short: " + datFileName + "\n");
+    }
 
-    circuit->witness2SignalList = new u64[get_size_of_witness()];
-    uint inisize = dsize;    
-    dsize = get_size_of_witness()*sizeof(u64);
-    memcpy((void *)(circuit->witness2SignalList), (void *)(bdata+inisize), dsize);
+    if (inPlace) {
+      circuit->InputHashMap = (HashSignalInfo *)bdata;
+      circuit->witness2SignalList = (u64 *)(bdata+hashmapSize);
+      circuit->circuitConstants = (FrElement *)(bdata+hashmapSize+witnessSize);
+      circuit->mapping = bdata;
+      circuit->mappingSize = sb.st_size;
+    } else {
+      circuit->InputHashMap = new HashSignalInfo[get_size_of_input_hashmap()];
+      memcpy((void *)(circuit->InputHashMap), (void *)bdata, hashmapSize);
 
-    circuit->circuitConstants = new FrElement[get_size_of_constants()];
-    if (get_size_of_constants()>0) {
-      inisize += dsize;
-      dsize = get_size_of_constants()*sizeof(FrElement);
-      memcpy((void *)(circuit->circuitConstants), (void *)(bdata+inisize), dsize);
+      circuit->witness2SignalList = new u64[get_size_of_witness()];
+      memcpy((void *)(circuit->witness2SignalList), (void *)(bdata+hashmapSize), witnessSize);
+
+      circuit->circuitConstants = new FrElement[get_size_of_constants()];
+      memcpy((void *)(circuit->circuitConstants), (void *)(bdata+hashmapSize+witnessSize), constantsSize);
     }
+    validateCircuit(circuit);
+    constantsToMontgomery(circuit, inPlace);
+    resolveInputSignals(circuit);
 
-    std::map<u32,IODefPair> templateInsId2IOSignalInfo1;
+    uint inisize = hashmapSize + witnessSize;
+    uint dsize = constantsSize;
     if (get_size_of_io_map()>0) {
-      u32 index[get_size_of_io_map()];
       inisize += dsize;
       dsize = get_size_of_io_map()*sizeof(u32);
-      memcpy((void *)index, (void *)(bdata+inisize), dsize);
-      inisize += dsize;
-      assert(inisize % sizeof(u32) == 0);    
-      assert(sb.st_size % sizeof(u32) == 0);
-      u32 dataiomap[(sb.st_size-inisize)/sizeof(u32)];
-      memcpy((void *)dataiomap, (void *)(bdata+inisize), sb.st_size-inisize);
-      u32* pu32 = dataiomap;
-
-      for (int i = 0; i < get_size_of_io_map(); i++) {
-	u32 n = *pu32;
-	IODefPair p;
-	p.len = n;
-	IODef defs[n];
-	pu32 += 1;
-	for (u32 j = 0; j <n; j++){
-	  defs[j].offset=*pu32;
-	  u32 len = *(pu32+1);
-	  defs[j].len = len;
-	  defs[j].lengths = new u32[len];
-	  memcpy((void *)defs[j].lengths,(void *)(pu32+2),len*sizeof(u32));
-	  pu32 += len + 2;
-	}
-	p.defs = (IODef*)calloc(10, sizeof(IODef));
-	for (u32 j = 0; j < p.len; j++){
-	  p.defs[j] = defs[j];
-	}
-	templateInsId2IOSignalInfo1[index[i]] = p;
+      if ((u64)sb.st_size < (u64)inisize + dsize || sb.st_size % sizeof(u32) != 0) {
+        throw std::runtime_error(".dat file corrupted: invalid io map\n");
       }
+      u32 *index = (u32 *)(bdata+inisize);
+      inisize += dsize;
+      loadIOMap(circuit->templateInsId2IOSignalInfo, index, get_size_of_io_map(),
+                (u32 *)(bdata+inisize), (sb.st_size-inisize)/sizeof(u32));
     }
-    circuit->templateInsId2IOSignalInfo = move(templateInsId2IOSignalInfo1);
     
-    munmap(bdata, sb.st_size);
+    if (!inPlace) {
+      munmap(bdata, sb.st_size);
+    }
     
     return circuit;
 }
@@ -113,147 +244,872 @@ bool check_valid_number(std::string & s, uint base){
   return is_valid;
 }
 
-void json2FrElements (json val, std::vector<FrElement> & vval){
-  if (!val.is_array()) {
-    FrElement v;
-    std::string s_aux, s;
-    uint base;
-    if (val.is_string()) {
-      s_aux = val.get<std::string>();
-      std::string possible_prefix = s_aux.substr(0, 2);
-      if (possible_prefix == "0b" || possible_prefix == "0B"){
-        s = s_aux.substr(2, s_aux.size() - 2);
-        base = 2; 
-      } else if (possible_prefix == "0o" || possible_prefix == "0O"){
-        s = s_aux.substr(2, s_aux.size() - 2);
-        base = 8; 
-      } else if (possible_prefix == "0x" || possible_prefix == "0X"){
-        s = s_aux.substr(2, s_aux.size() - 2);
-        base = 16;
-      } else{
-        s = s_aux;
-        base = 10;
+// Converts a string value: decimal, or binary, octal or hex with a prefix
+void str2FrElement(std::string const &s_aux, FrElement &v) {
+  std::string s;
+  uint base;
+  std::string possible_prefix = s_aux.substr(0, 2);
+  if (possible_prefix == "0b" || possible_prefix == "0B"){
+    s = s_aux.substr(2, s_aux.size() - 2);
+    base = 2;
+  } else if (possible_prefix == "0o" || possible_prefix == "0O"){
+    s = s_aux.substr(2, s_aux.size() - 2);
+    base = 8;
+  } else if (possible_prefix == "0x" || possible_prefix == "0X"){
+    s = s_aux.substr(2, s_aux.size() - 2);
+    base = 16;
+  } else{
+    s = s_aux;
+    base = 10;
+  }
+  if (!check_valid_number(s, base)){
+    std::ostringstream errStrStream;
+    errStrStream << "Invalid number in JSON input: " << s_aux << "\n";
+    throw std::runtime_error(errStrStream.str() );
+  }
+  Fr_str2element (&v, s.c_str(), base);
+}
+
+// Decimal digits whose value fits in an int32 make a short element without GMP
+bool digits2ShortFrElement(const char *s, size_t len, bool negative, FrElement &v) {
+  if (len == 0 || len > 10) return false;
+  int64_t x = 0;
+  for (size_t i = 0; i < len; i++) {
+    if (s[i] < '0' || s[i] > '9') return false;
+    x = x*10 + (s[i] - '0');
+  }
+  if (negative) x = -x;
+  if (x > INT32_MAX || x < INT32_MIN) return false;
+  v.type = Fr_SHORT;
+  v.shortVal = (int32_t)x;
+  return true;
+}
+
+/*
+Streaming reader for input documents: a json object whose values are
+numbers, strings or (nested) arrays of them, flattened. Values are
+converted while they are read, without building a document, so the
+common small values never go through std::string or GMP. Arrays nest at
+most JSON_MAX_DEPTH deep: the signals of the circuits have a few
+dimensions, and a deeper document is refused instead of recursing.
+*/
+
+#define JSON_MAX_DEPTH 8
+
+class JsonInputReader {
+  const char *begin;
+  const char *p;
+  const char *end;
+
+  [[noreturn]] void fail(const char *what) {
+    throw std::runtime_error(std::string("Invalid JSON input: ") + what + " at offset " + std::to_string(p - begin) + "\n");
+  }
+
+  void skipSpace() {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) p++;
+  }
+
+  void expect(char c) {
+    skipSpace();
+    if (p == end || *p != c) fail("unexpected character");
+    p++;
+  }
+
+  u32 readHex4() {
+    if (end - p < 4) fail("bad escape");
+    u32 c = 0;
+    for (int i = 0; i < 4; i++, p++) {
+      char h = *p;
+      c <<= 4;
+      if (h >= '0' && h <= '9') c |= h - '0';
+      else if (h >= 'a' && h <= 'f') c |= h - 'a' + 10;
+      else if (h >= 'A' && h <= 'F') c |= h - 'A' + 10;
+      else fail("bad escape");
+    }
+    return c;
+  }
+
+  void readString(std::string &s) {
+    expect('"');
+    s.clear();
+    while (true) {
+      const char *start = p;
+      while (p < end && *p != '"' && *p != '\\') p++;
+      s.append(start, p - start);
+      if (p == end) fail("unterminated string");
+      if (*p++ == '"') return;
+      if (p == end) fail("unterminated string");
+      char c = *p++;
+      switch (c) {
+        case '"': case '\\': case '/': s += c; break;
+        case 'b': s += '\b'; break;
+        case 'f': s += '\f'; break;
+        case 'n': s += '\n'; break;
+        case 'r': s += '\r'; break;
+        case 't': s += '\t'; break;
+        case 'u': {
+          u32 cp = readHex4();
+          if (cp < 0x80) {
+            s += (char)cp;
+          } else if (cp < 0x800) {
+            s += (char)(0xC0 | (cp >> 6));
+            s += (char)(0x80 | (cp & 0x3F));
+          } else {
+            s += (char)(0xE0 | (cp >> 12));
+            s += (char)(0x80 | ((cp >> 6) & 0x3F));
+            s += (char)(0x80 | (cp & 0x3F));
+          }
+          break;
+        }
+        default: fail("bad escape");
       }
-      if (!check_valid_number(s, base)){
-        std::ostringstream errStrStream;
-        errStrStream << "Invalid number in JSON input: " << s_aux << "\n";
-	      throw std::runtime_error(errStrStream.str() );
+    }
+  }
+
+  void readNumber(FrElement &v) {
+    const char *start = p;
+    bool negative = *p == '-';
+    if (negative) p++;
+    const char *digits = p;
+    while (p < end && *p >= '0' && *p <= '9') p++;
+    size_t nDigits = p - digits;
+    if (nDigits == 0) fail("bad number");
+    bool integer = true;
+    if (p < end && *p == '.') {
+      integer = false;
+      p++;
+      while (p < end && *p >= '0' && *p <= '9') p++;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+      integer = false;
+      p++;
+      if (p < end && (*p == '+' || *p == '-')) p++;
+      while (p < end && *p >= '0' && *p <= '9') p++;
+    }
+    if (integer && digits2ShortFrElement(digits, nDigits, negative, v)) return;
+    std::string s;
+    if (integer) {
+      s.assign(start, p - start);
+    } else {
+      std::stringstream stream;
+      stream << std::fixed << std::setprecision(0) << strtod(std::string(start, p - start).c_str(), NULL);
+      s = stream.str();
+    }
+    Fr_str2element (&v, s.c_str(), 10);
+  }
+
+  void readValue(std::vector<FrElement> &vval, std::string &str, uint depth) {
+    skipSpace();
+    if (p == end) fail("unexpected end");
+    if (*p == '[') {
+      if (depth == JSON_MAX_DEPTH) fail("arrays nested too deep");
+      p++;
+      skipSpace();
+      if (p < end && *p == ']') {
+        p++;
+        return;
+      }
+      while (true) {
+        readValue(vval, str, depth + 1);
+        skipSpace();
+        if (p < end && *p == ',') {
+          p++;
+        } else {
+          expect(']');
+          return;
+        }
       }
-    } else if (val.is_number()) {
-        double vd = val.get<double>();
-        std::stringstream stream;
-        stream << std::fixed << std::setprecision(0) << vd;
-        s = stream.str();
-        base = 10;
+    }
+    FrElement v;
+    if (*p == '"') {
+      readString(str);
+      if (!digits2ShortFrElement(str.data(), str.size(), false, v)) {
+        str2FrElement(str, v);
+      }
+    } else if (*p == '-' || (*p >= '0' && *p <= '9')) {
+      readNumber(v);
     } else {
-        std::ostringstream errStrStream;
-        errStrStream << "Invalid JSON type\n";
-	      throw std::runtime_error(errStrStream.str() );
+      std::ostringstream errStrStream;
+      errStrStream << "Invalid JSON type\n";
+      throw std::runtime_error(errStrStream.str() );
     }
-    Fr_str2element (&v, s.c_str(), base);
     vval.push_back(v);
-  } else {
-    for (uint i = 0; i < val.size(); i++) {
-      json2FrElements (val[i], vval);
-    }
   }
-}
 
+public:
+  JsonInputReader(const char *data, size_t size) : begin(data), p(data), end(data + size) {}
 
-void loadJson(Circom_CalcWit *ctx, std::string filename) {
-  std::ifstream inStream(filename);
-  json j;
-  inStream >> j;
-  
-  u64 nItems = j.size();
-  // printf("Items : %llu\n",nItems);
-  if (nItems == 0){
-    ctx->tryRunCircuit();
-  }
-  for (json::iterator it = j.begin(); it != j.end(); ++it) {
-    // std::cout << it.key() << " => " << it.value() << '\n';
-    u64 h = fnv1a(it.key());
+  // Calls emit with every key of the document and its values
+  void read(std::function<void(std::string const &, std::vector<FrElement> &)> const &emit) {
+    std::string key, str;
     std::vector<FrElement> v;
-    json2FrElements(it.value(),v);
-    uint signalSize = ctx->getInputSignalSize(h);
+    expect('{');
+    skipSpace();
+    if (p < end && *p == '}') {
+      p++;
+    } else {
+      while (true) {
+        readString(key);
+        expect(':');
+        v.clear();
+        readValue(v, str, 0);
+        emit(key, v);
+        skipSpace();
+        if (p < end && *p == ',') {
+          p++;
+        } else {
+          expect('}');
+          break;
+        }
+      }
+    }
+    skipSpace();
+    if (p != end) fail("trailing characters");
+  }
+};
+
+// Parses an input document, resolving every signal and checking its size
+void readJsonInputs(Circom_CalcWit *ctx, std::istream &inStream,
+                    std::function<void(std::string const &, uint, std::vector<FrElement> &)> const &emit) {
+  std::string doc((std::istreambuf_iterator<char>(inStream)), std::istreambuf_iterator<char>());
+  JsonInputReader reader(doc.data(), doc.size());
+  reader.read([ctx, &emit](std::string const &key, std::vector<FrElement> &v) {
+    uint handle = ctx->getInputSignalHandle(fnv1a(key));
+    uint signalSize = ctx->getInputSignalInfo(handle).signalsize;
     if (v.size() < signalSize) {
 	std::ostringstream errStrStream;
-	errStrStream << "Error loading signal " << it.key() << ": Not enough values\n";
+	errStrStream << "Error loading signal " << key << ": Not enough values\n";
 	throw std::runtime_error(errStrStream.str() );
     }
     if (v.size() > signalSize) {
 	std::ostringstream errStrStream;
-	errStrStream << "Error loading signal " << it.key() << ": Too many values\n";
+	errStrStream << "Error loading signal " << key << ": Too many values\n";
 	throw std::runtime_error(errStrStream.str() );
     }
-    for (uint i = 0; i<v.size(); i++){
-      try {
-	// std::cout << it.key() << "," << i << " => " << Fr_element2str(&(v[i])) << '\n';
-	ctx->setInputSignal(h,i,v[i]);
-      } catch (std::runtime_error e) {
-	std::ostringstream errStrStream;
-	errStrStream << "Error setting signal: " << it.key() << "\n" << e.what();
-	throw std::runtime_error(errStrStream.str() );
-      }
+    emit(key, handle, v);
+  });
+}
+
+void loadJson(Circom_CalcWit *ctx, std::istream &inStream) {
+  bool empty = true;
+  readJsonInputs(ctx, inStream, [ctx, &empty](std::string const &key, uint handle, std::vector<FrElement> &v) {
+    empty = false;
+    try {
+      ctx->setInputSignals(handle, v.data(), v.size());
+    } catch (Circom_FailedAssert &e) {
+      // the last input ran the circuit: the error is not about this signal
+      throw;
+    } catch (std::runtime_error e) {
+      std::ostringstream errStrStream;
+      errStrStream << "Error setting signal: " << key << "\n" << e.what();
+      throw std::runtime_error(errStrStream.str() );
     }
+  });
+  if (empty) {
+    ctx->tryRunCircuit();
   }
 }
 
-void writeBinWitness(Circom_CalcWit *ctx, std::string wtnsFileName) {
-    FILE *write_ptr;
+void loadJson(Circom_CalcWit *ctx, std::string filename) {
+  std::ifstream inStream(filename);
+  if (!inStream) {
+    std::ostringstream errStrStream;
+    errStrStream << "Cannot open input file: " << filename << "\n";
+    throw std::runtime_error(errStrStream.str() );
+  }
+  loadJson(ctx, inStream);
+}
 
-    write_ptr = fopen(wtnsFileName.c_str(),"wb");
+/*
+Binary input format (.winp), all integers little endian:
 
-    fwrite("wtns", 4, 1, write_ptr);
+  "winp"               magic
+  u32                  version (1)
+  u32                  first main input signal of the circuit
+  u32                  number of main input signals of the circuit
+  u32                  number of records
+  records:
+    u32                signal id of the first element of an input
+    u32                number of elements, the size of the input
+    FrElement[n]       the elements, laid out as in fr.hpp (and the .dat)
 
-    u32 version = 2;
-    fwrite(&version, 4, 1, write_ptr);
+Signal ids are those of the .dat the file was made for, which the two
+circuit fields guard against. An input is set with a single copy, with
+no parsing. --winp converts a json input to this format.
+*/
 
-    u32 nSections = 2;
-    fwrite(&nSections, 4, 1, write_ptr);
+const u32 winpVersion = 1;
 
-    // Header
-    u32 idSection1 = 1;
-    fwrite(&idSection1, 4, 1, write_ptr);
+void loadWinp(Circom_CalcWit *ctx, const u8 *data, size_t size) {
+  const u8 *p = data;
+  const u8 *end = data + size;
+  u32 header[4];
+  if (size < 4 + sizeof(header) || memcmp(p, "winp", 4) != 0) {
+    throw std::runtime_error("Invalid .winp file\n");
+  }
+  memcpy(header, p + 4, sizeof(header));
+  p += 4 + sizeof(header);
+  if (header[0] != winpVersion) {
+    throw std::runtime_error("Unsupported .winp version: " + std::to_string(header[0]) + "\n");
+  }
+  if (header[1] != get_main_input_signal_start() || header[2] != get_main_input_signal_no()) {
+    throw std::runtime_error(".winp file made for another circuit\n");
+  }
+  for (u32 r = 0; r < header[3]; r++) {
+    u32 record[2];
+    if ((size_t)(end - p) < sizeof(record)) {
+      throw std::runtime_error(".winp file too short\n");
+    }
+    memcpy(record, p, sizeof(record));
+    p += sizeof(record);
+    uint handle = ctx->getInputSignalHandleById(record[0]);
+    if (record[1] != ctx->getInputSignalInfo(handle).signalsize) {
+      throw std::runtime_error("Error loading signal " + std::to_string(record[0]) + ": wrong number of values\n");
+    }
+    if ((size_t)(end - p) / sizeof(FrElement) < record[1]) {
+      throw std::runtime_error(".winp file too short\n");
+    }
+    const FrElement *vals = (const FrElement *)p;
+    for (u32 i = 0; i < record[1]; i++) {
+      if (!isValidFrElement(vals[i])) {
+        throw std::runtime_error("Error loading signal " + std::to_string(record[0]) + ": invalid value\n");
+      }
+    }
+    ctx->setInputSignals(handle, vals, record[1]);
+    p += record[1]*sizeof(FrElement);
+  }
+  if (header[3] == 0) {
+    ctx->tryRunCircuit();
+  }
+}
 
-    u32 n8 = Fr_N64*8;
+void loadWinp(Circom_CalcWit *ctx, std::string filename) {
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd == -1) {
+    throw std::runtime_error("Cannot open input file: " + filename + "\n");
+  }
+  struct stat sb;
+  if (fstat(fd, &sb) == -1) {
+    close(fd);
+    throw std::system_error(errno, std::generic_category(), "fstat " + filename);
+  }
+  if (sb.st_size == 0) {
+    close(fd);
+    throw std::runtime_error("Invalid .winp file\n");
+  }
+  u8 *data = (u8 *)mmap(NULL, sb.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    throw std::system_error(errno, std::generic_category(), "mmap " + filename);
+  }
+  try {
+    loadWinp(ctx, data, sb.st_size);
+  } catch (...) {
+    munmap(data, sb.st_size);
+    throw;
+  }
+  munmap(data, sb.st_size);
+}
 
-    u64 idSection1length = 8 + n8;
-    fwrite(&idSection1length, 8, 1, write_ptr);
+// Writes a json input as .winp, resolving its signals with ctx
+void json2Winp(Circom_CalcWit *ctx, std::istream &inStream, FILE *write_ptr) {
+  std::string records;
+  u32 nRecords = 0;
+  readJsonInputs(ctx, inStream, [ctx, &records, &nRecords](std::string const &, uint handle, std::vector<FrElement> &v) {
+    u32 record[2] = { ctx->getInputSignalInfo(handle).signalid, (u32)v.size() };
+    records.append((const char *)record, sizeof(record));
+    records.append((const char *)v.data(), v.size()*sizeof(FrElement));
+    nRecords++;
+  });
+  u32 header[4] = { winpVersion, get_main_input_signal_start(), get_main_input_signal_no(), nRecords };
+  fwrite("winp", 4, 1, write_ptr);
+  fwrite(header, sizeof(header), 1, write_ptr);
+  fwrite(records.data(), records.size(), 1, write_ptr);
+}
 
-    fwrite(&n8, 4, 1, write_ptr);
+bool hasSuffix(std::string const &s, std::string const &suffix) {
+  return s.size() >= suffix.size() && s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// Loads a .winp or a json input file
+void loadInput(Circom_CalcWit *ctx, std::string const &filename) {
+  if (hasSuffix(filename, ".winp")) {
+    loadWinp(ctx, filename);
+  } else {
+    loadJson(ctx, filename);
+  }
+}
+
+/*
+The .wtns image is built in one pass into a single buffer: the header,
+then every witness in normal form. A named regular file is sized and
+mapped so the image is built in place; anything else (stdout, a pipe, a
+socket) gets the image from one buffer in as few writes as it accepts.
+*/
 
-    fwrite(Fr_q.longVal, Fr_N64*8, 1, write_ptr);
+size_t binWitnessSize() {
+    return 76 + (size_t)Fr_N64*8*get_size_of_witness();
+}
 
+void buildBinWitness(Circom_CalcWit *ctx, u8 *buf) {
+    u32 n8 = Fr_N64*8;
     uint Nwtns = get_size_of_witness();
-    
+    u32 version = 2;
+    u32 nSections = 2;
+    u32 idSection1 = 1;
+    u64 idSection1length = 8 + n8;
     u32 nVars = (u32)Nwtns;
-    fwrite(&nVars, 4, 1, write_ptr);
-
-    // Data
     u32 idSection2 = 2;
-    fwrite(&idSection2, 4, 1, write_ptr);
-    
     u64 idSection2length = (u64)n8*(u64)Nwtns;
-    fwrite(&idSection2length, 8, 1, write_ptr);
 
-    FrElement v;
+    u8 *p = buf;
+    memcpy(p, "wtns", 4); p += 4;
+    memcpy(p, &version, 4); p += 4;
+    memcpy(p, &nSections, 4); p += 4;
+
+    // Header
+    memcpy(p, &idSection1, 4); p += 4;
+    memcpy(p, &idSection1length, 8); p += 8;
+    memcpy(p, &n8, 4); p += 4;
+    memcpy(p, Fr_q.longVal, n8); p += n8;
+    memcpy(p, &nVars, 4); p += 4;
 
-    for (int i=0;i<Nwtns;i++) {
+    // Data
+    memcpy(p, &idSection2, 4); p += 4;
+    memcpy(p, &idSection2length, 8); p += 8;
+
+    FrElement v;
+    for (uint i=0;i<Nwtns;i++) {
         ctx->getWitness(i, &v);
-        Fr_toLongNormal(&v, &v);
-        fwrite(v.longVal, Fr_N64*8, 1, write_ptr);
+        if (v.type == Fr_SHORT && v.shortVal >= 0) {
+            // most witnesses are small, and are already in normal form
+            u64 w[Fr_N64] = { (u64)v.shortVal };
+            memcpy(p, w, n8);
+        } else {
+            Fr_toLongNormal(&v, &v);
+            memcpy(p, v.longVal, n8);
+        }
+        p += n8;
     }
-    fclose(write_ptr);
+}
+
+void buildBinWitness(Circom_CalcWit *ctx, std::string &out) {
+    out.resize(binWitnessSize());
+    buildBinWitness(ctx, (u8 *)&out[0]);
+}
+
+void writeBinWitness(Circom_CalcWit *ctx, int fd) {
+    std::string image;
+    buildBinWitness(ctx, image);
+    const char *p = image.data();
+    size_t len = image.size();
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0) {
+            throw std::system_error(errno, std::generic_category(), "write");
+        }
+        p += n;
+        len -= n;
+    }
+}
+
+// Writes to wtnsFileName, or to stdout for "-"
+void writeBinWitness(Circom_CalcWit *ctx, std::string wtnsFileName) {
+    if (wtnsFileName == "-") {
+        writeBinWitness(ctx, STDOUT_FILENO);
+        return;
+    }
+    int fd = open(wtnsFileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666);
+    if (fd == -1) {
+        throw std::system_error(errno, std::generic_category(), "open " + wtnsFileName);
+    }
+    struct stat sb;
+    if (fstat(fd, &sb) == -1 || !S_ISREG(sb.st_mode)) {
+        try {
+            writeBinWitness(ctx, fd);
+        } catch (...) {
+            close(fd);
+            throw;
+        }
+        close(fd);
+        return;
+    }
+    size_t size = binWitnessSize();
+    if (ftruncate(fd, size) == -1) {
+        int err = errno;
+        close(fd);
+        throw std::system_error(err, std::generic_category(), "ftruncate " + wtnsFileName);
+    }
+    u8 *image = (u8 *)mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (image == MAP_FAILED) {
+        throw std::system_error(errno, std::generic_category(), "mmap " + wtnsFileName);
+    }
+    buildBinWitness(ctx, image);
+    munmap(image, size);
+}
+
+void checkAllInputsSet(Circom_CalcWit *ctx) {
+  if (ctx->getRemaingInputsToBeSet()!=0) {
+    std::ostringstream errStrStream;
+    errStrStream << "Not all inputs have been set. Only " << get_main_input_signal_no()-ctx->getRemaingInputsToBeSet() << " out of " << get_main_input_signal_no() << "\n";
+    throw std::runtime_error(errStrStream.str() );
+  }
+}
+
+// Runs a (possibly used) context on a new input document
+void computeWitness(Circom_CalcWit *ctx, std::istream &inStream) {
+  ctx->reset();
+  loadJson(ctx, inStream);
+  checkAllInputsSet(ctx);
+}
+
+void computeWitness(Circom_CalcWit *ctx, std::string const &inputfile) {
+  ctx->reset();
+  loadInput(ctx, inputfile);
+  checkAllInputsSet(ctx);
+}
+
+/*
+Batch mode: one witness per input document. The input is either a
+JSONL file, whose n-th line (counting from 0) is written to
+<outdir>/<n>.wtns, or a directory, whose <name>.json and <name>.winp
+files are written to <outdir>/<name>.wtns. Failing entries are reported and skipped:
+their worker goes on with the next one, and its context is reset for it.
+
+The entries are fed through a bounded queue to worker threads, each one
+owning a context and sharing the (read-only) circuit.
+*/
+
+struct WitnessJob {
+  std::string name;      // used to report errors
+  std::string json;      // the input document, or empty to read inputfile
+  std::string inputfile;
+  std::string wtnsfile;
+};
+
+void readBatch(std::string const &input, std::string const &outdir, std::function<void(WitnessJob &)> const &emit) {
+  struct stat sb;
+  if (stat(input.c_str(), &sb) == -1) {
+    throw std::system_error(errno, std::generic_category(), "stat " + input);
+  }
+  if (mkdir(outdir.c_str(), 0777) == -1 && errno != EEXIST) {
+    throw std::system_error(errno, std::generic_category(), "mkdir " + outdir);
+  }
+  if (S_ISDIR(sb.st_mode)) {
+    DIR *dir = opendir(input.c_str());
+    if (dir == NULL) {
+      throw std::system_error(errno, std::generic_category(), "opendir " + input);
+    }
+    std::vector<std::string> names;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+      std::string name(entry->d_name);
+      if (hasSuffix(name, ".json") || hasSuffix(name, ".winp")) {
+        names.push_back(name);
+      }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+    for (uint i = 0; i < names.size(); i++) {
+      WitnessJob job;
+      job.name = names[i];
+      job.inputfile = input + "/" + names[i];
+      job.wtnsfile = outdir + "/" + names[i].substr(0, names[i].size() - 5) + ".wtns";
+      emit(job);
+    }
+  } else {
+    std::ifstream inStream(input);
+    std::string line;
+    for (uint lineno = 0; std::getline(inStream, line); lineno++) {
+      if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+      WitnessJob job;
+      job.name = input + ":" + std::to_string(lineno);
+      job.json.swap(line);
+      job.wtnsfile = outdir + "/" + std::to_string(lineno) + ".wtns";
+      emit(job);
+    }
+  }
+}
+
+bool runJob(Circom_CalcWit *ctx, WitnessJob const &job) {
+  try {
+    if (job.json.empty()) {
+      computeWitness(ctx, job.inputfile);
+    } else {
+      std::istringstream inStream(job.json);
+      computeWitness(ctx, inStream);
+    }
+    writeBinWitness(ctx, job.wtnsfile);
+  } catch (std::exception &e) {
+    std::string msg(e.what());
+    if (msg.empty() || msg.back() != '\n') msg += "\n";
+    std::cerr << job.name + ": " + msg << std::flush;
+    return false;
+  } catch (...) {
+    // whatever it was, the worker goes on with the next entry
+    std::cerr << job.name + ": unknown error\n" << std::flush;
+    return false;
+  }
+  return true;
+}
+
+class JobQueue {
+
+  std::mutex mutex;
+  std::condition_variable notEmpty;
+  std::condition_variable notFull;
+  std::deque<WitnessJob> jobs;
+  size_t capacity;
+  bool closed;
+
+public:
+
+  JobQueue(size_t aCapacity) : capacity(aCapacity), closed(false) {}
+
+  void push(WitnessJob &job) {
+    std::unique_lock<std::mutex> lock(mutex);
+    notFull.wait(lock, [this] { return jobs.size() < capacity; });
+    jobs.push_back(std::move(job));
+    notEmpty.notify_one();
+  }
+
+  // Returns false once the queue is closed and drained
+  bool pop(WitnessJob &job) {
+    std::unique_lock<std::mutex> lock(mutex);
+    notEmpty.wait(lock, [this] { return closed || !jobs.empty(); });
+    if (jobs.empty()) return false;
+    job = std::move(jobs.front());
+    jobs.pop_front();
+    notFull.notify_one();
+    return true;
+  }
+
+  void close() {
+    std::lock_guard<std::mutex> lock(mutex);
+    closed = true;
+    notEmpty.notify_all();
+  }
+};
+
+// Returns the number of failed entries
+uint batchWitness(Circom_Circuit *circuit, std::string const &input, std::string const &outdir, uint nThreads) {
+  JobQueue queue(4 * nThreads);
+  std::atomic<uint> failed(0);
+  std::vector<std::thread> workers;
+  for (uint i = 0; i < nThreads; i++) {
+    workers.emplace_back([&] {
+      // the workers already keep the cores busy: with more than one, the
+      // parallel subcomponents of a witness run in the worker's thread
+      Circom_CalcWit *ctx = new Circom_CalcWit(circuit, nThreads > 1 ? 0 : NMUTEXES);
+      WitnessJob job;
+      while (queue.pop(job)) {
+        if (!runJob(ctx, job)) failed++;
+      }
+      delete ctx;
+    });
+  }
+  uint total = 0;
+  try {
+    readBatch(input, outdir, [&](WitnessJob &job) {
+      total++;
+      queue.push(job);
+    });
+  } catch (...) {
+    queue.close();
+    for (auto &worker : workers) worker.join();
+    throw;
+  }
+  queue.close();
+  for (auto &worker : workers) worker.join();
+  std::cerr << total - failed << " of " << total << " witnesses written to " << outdir << std::endl;
+  return failed;
+}
+
+/*
+Server mode: the circuit is loaded once and witnesses are served over a
+unix domain socket by a pool of worker threads, each one owning a context
+and serving one connection at a time, like the workers of the batch mode.
+A connection can carry any number of requests, each one answered before
+the next is read. A connection that sends or receives nothing for
+SERVE_TIMEOUT seconds, idle or stalled in the middle of a request, is
+closed so that its worker can take the next one.
+
+  request:  u32 len, len bytes of payload
+  response: u32 status (0 ok, 1 error), u64 len, len bytes of payload
+
+The payload of a request is either an input json document (it starts
+with '{'), answered with the .wtns bytes, or the two paths
+"<input.json|input.winp> <output.wtns>", answered with the output path
+once the witness has been written. Errors are answered with their message,
+and so is a failed check of the circuit: the server goes on with the next
+request. A request longer than SERVE_MAX_REQUEST is refused and its
+connection closed.
+*/
+
+#define SERVE_MAX_REQUEST (64 << 20)
+#define SERVE_TIMEOUT 10
+
+bool readFully(int fd, void *buf, size_t len) {
+  u8 *p = (u8 *)buf;
+  while (len > 0) {
+    ssize_t n = read(fd, p, len);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    p += n;
+    len -= n;
+  }
+  return true;
+}
+
+bool writeFully(int fd, const void *buf, size_t len) {
+  const u8 *p = (const u8 *)buf;
+  while (len > 0) {
+    ssize_t n = send(fd, p, len, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    p += n;
+    len -= n;
+  }
+  return true;
+}
+
+bool sendResponse(int fd, u32 status, const char *data, u64 len) {
+  return writeFully(fd, &status, 4) && writeFully(fd, &len, 8) && writeFully(fd, data, len);
+}
+
+bool serveRequest(Circom_CalcWit *ctx, int fd, std::string const &payload) {
+  std::string response;
+  u32 status = 0;
+  try {
+    size_t start = payload.find_first_not_of(" \t\r\n");
+    if (start != std::string::npos && payload[start] == '{') {
+      std::istringstream inStream(payload);
+      computeWitness(ctx, inStream);
+      buildBinWitness(ctx, response);
+    } else {
+      std::istringstream paths(payload);
+      std::string inputfile, wtnsfile;
+      if (!(paths >> inputfile >> wtnsfile)) {
+        throw std::runtime_error("Invalid request: expected a json document or <input.json|input.winp> <output.wtns>\n");
+      }
+      computeWitness(ctx, inputfile);
+      writeBinWitness(ctx, wtnsfile);
+      response = wtnsfile;
+    }
+  } catch (std::exception &e) {
+    status = 1;
+    response = e.what();
+  }
+  return sendResponse(fd, status, response.data(), response.size());
+}
+
+void serveConnection(Circom_CalcWit *ctx, int cfd) {
+  struct timeval timeout;
+  timeout.tv_sec = SERVE_TIMEOUT;
+  timeout.tv_usec = 0;
+  setsockopt(cfd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  setsockopt(cfd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+  u32 len;
+  std::string payload;
+  while (readFully(cfd, &len, 4)) {
+    if (len > SERVE_MAX_REQUEST) {
+      std::string msg = "Request too long: " + std::to_string(len) + " bytes\n";
+      sendResponse(cfd, 1, msg.data(), msg.size());
+      break;
+    }
+    payload.resize(len);
+    if (len > 0 && !readFully(cfd, &payload[0], len)) break;
+    if (!serveRequest(ctx, cfd, payload)) break;
+  }
+}
+
+void serveWitness(Circom_Circuit *circuit, std::string const &socketPath, uint nThreads) {
+  struct sockaddr_un addr;
+  if (socketPath.size() >= sizeof(addr.sun_path)) {
+    throw std::runtime_error("Socket path too long: " + socketPath);
+  }
+  int sfd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (sfd == -1) {
+    throw std::system_error(errno, std::generic_category(), "socket");
+  }
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, socketPath.c_str(), sizeof(addr.sun_path) - 1);
+  unlink(socketPath.c_str());
+  if (bind(sfd, (struct sockaddr *)&addr, sizeof(addr)) == -1) {
+    throw std::system_error(errno, std::generic_category(), "bind " + socketPath);
+  }
+  if (listen(sfd, SOMAXCONN) == -1) {
+    throw std::system_error(errno, std::generic_category(), "listen");
+  }
+  signal(SIGPIPE, SIG_IGN);
+
+  std::vector<std::thread> workers;
+  for (uint i = 0; i < nThreads; i++) {
+    workers.emplace_back([&] {
+      // as in the batch mode, with more than one worker the parallel
+      // subcomponents of a witness run in the worker's thread
+      Circom_CalcWit *ctx = new Circom_CalcWit(circuit, nThreads > 1 ? 0 : NMUTEXES);
+      for (;;) {
+        int cfd = accept(sfd, NULL, NULL);
+        if (cfd == -1) {
+          if (errno == EINTR || errno == ECONNABORTED) continue;
+          throw std::system_error(errno, std::generic_category(), "accept");
+        }
+        serveConnection(ctx, cfd);
+        close(cfd);
+      }
+    });
+  }
+  for (auto &worker : workers) worker.join();
+}
+
+// Parses the <threads> of -j, 0 for every core
+uint parseThreads(const char *arg) {
+  uint nThreads = std::stoul(arg);
+  if (nThreads == 0) nThreads = std::max(1u, std::thread::hardware_concurrency());
+  return nThreads;
 }
 
 int main (int argc, char *argv[]) {
   std::string cl(argv[0]);
-  if (argc!=3) {
-        std::cout << "Usage: " << cl << " <input.json> <output.wtns>\n";
+  std::string mode(argc > 1 ? argv[1] : "");
+  if ((argc==3 || (argc==5 && std::string(argv[3]) == "-j")) && mode == "--serve") {
+    uint nThreads = argc==5 ? parseThreads(argv[4]) : 1;
+    std::string datfile = cl + ".dat";
+    Circom_Circuit *circuit = loadCircuit(datfile);
+    serveWitness(circuit, argv[2], nThreads);
+  } else if ((argc==4 || (argc==6 && std::string(argv[4]) == "-j")) && mode == "--batch") {
+    uint nThreads = argc==6 ? parseThreads(argv[5]) : 1;
+    std::string datfile = cl + ".dat";
+    Circom_Circuit *circuit = loadCircuit(datfile);
+    if (batchWitness(circuit, argv[2], argv[3], nThreads) != 0) {
+      return EXIT_FAILURE;
+    }
+  } else if (argc==4 && mode == "--winp") {
+    std::string datfile = cl + ".dat";
+    Circom_Circuit *circuit = loadCircuit(datfile);
+    Circom_CalcWit *ctx = new Circom_CalcWit(circuit);
+    std::ifstream inStream(argv[2]);
+    if (!inStream) {
+      throw std::runtime_error("Cannot open input file: " + std::string(argv[2]) + "\n");
+    }
+    FILE *write_ptr = fopen(argv[3], "wb");
+    if (write_ptr == NULL) {
+      throw std::system_error(errno, std::generic_category(), "fopen " + std::string(argv[3]));
+    }
+    json2Winp(ctx, inStream, write_ptr);
+    fclose(write_ptr);
+  } else if (argc!=3) {
+        std::cout << "Usage: " << cl << " <input.json|input.winp> <output.wtns|->\n";
+        std::cout << "       " << cl << " --batch <inputs.jsonl|inputs_dir> <output_dir> [-j <threads>]\n";
+        std::cout << "       " << cl << " --serve <socket> [-j <threads>]\n";
+        std::cout << "       " << cl << " --winp <input.json> <output.winp>\n";
   } else {
     std::string datfile = cl + ".dat";
-    std::string jsonfile(argv[1]);
+    std::string inputfile(argv[1]);
     std::string wtnsfile(argv[2]);
   
     // auto t_start = std::chrono::high_resolution_clock::now();
@@ -261,8 +1117,9 @@ int main (int argc, char *argv[]) {
    Circom_Circuit *circuit = loadCircuit(datfile);
 
    Circom_CalcWit *ctx = new Circom_CalcWit(circuit);
+   ctx->abortOnFailedAssert = true;
   
-   loadJson(ctx, jsonfile);
+   loadInput(ctx, inputfile);
    if (ctx->getRemaingInputsToBeSet()!=0) {
      std::cerr << "Not all inputs have been set. Only " << get_main_input_signal_no()-ctx->getRemaingInputsToBeSet() << " out of " << get_main_input_signal_no() << std::endl;
      assert(false);
@@ -0,0 +1,65 @@
+#ifndef __MIMC_H
+#define __MIMC_H
+
+#include "circom.hpp"
+#include "calcwit.hpp"
+#include "fr.hpp"
+
+#define MIMC_NROUNDS 220
+#ifdef PRUNE_SIGNALS
+#ifdef MIMC_VERIFY
+#error "MIMC_VERIFY needs the Feistels in the layout of circom, without PRUNE_SIGNALS"
+#endif
+// xL_out, xR_out, xL_in, t2[220], t4[220], xL[218]: xR_in, k, xL[218] (which
+// is xL_out) and xR[219] are not in the witness, and only live in the kernel
+#define MIMC_FEISTEL_SIZE 661
+#define MIMC_FEISTEL_T2 3
+#define MIMC_FEISTEL_NXL 218
+#else
+// xL_out, xR_out, xL_in, xR_in, k, t2[220], t4[220], xL[219], xR[219]
+#define MIMC_FEISTEL_SIZE 883
+#define MIMC_FEISTEL_T2 5
+#define MIMC_FEISTEL_NXL 219
+#define MIMC_FEISTEL_XR (MIMC_FEISTEL_XL + 219)
+#endif
+#define MIMC_FEISTEL_T4 (MIMC_FEISTEL_T2 + MIMC_NROUNDS)
+#define MIMC_FEISTEL_XL (MIMC_FEISTEL_T4 + MIMC_NROUNDS)
+
+// the number of signals of a MiMCFeistel(220) generated by circom
+#define MIMC_FEISTEL_SIGNALS 883
+
+#ifdef PRUNE_SIGNALS
+// The offset in the pruned layout of signal k of a Feistel generated by
+// circom, or -1 for the ones it drops
+inline int MiMCFeistel_prunedOffset(uint k) {
+    // xR_in and k are the signals 3 and 4, xL[218] and xR[219] the last 220
+    if (k == 3 || k == 4 || k >= MIMC_FEISTEL_SIGNALS - 220) return -1;
+    return k < 3 ? k : k - 2;
+}
+#endif
+
+/*
+Native MiMCSponge(nInputs, 220, nOutputs): computes every signal of the
+template (outs, and all the signals of its Feistel subcomponents) from
+ins and k, in the layout the generated code uses: outs[nOutputs],
+ins[nInputs], k, then the nInputs+nOutputs-1 Feistels S[i], each of
+MIMC_FEISTEL_SIZE signals. The Feistel subcomponents are created, but
+never run.
+*/
+void MiMCSponge_native(FrElement *signals, uint nInputs, uint nOutputs);
+
+// nLanes independent sponges of the same shape, computed in lockstep on
+// the vector units of the cpu (AVX-512 IFMA or AVX2, picked at startup)
+void MiMCSponge_native_lanes(PFrElement *signals, uint nLanes, uint nInputs, uint nOutputs);
+// the number of sponges computed in lockstep (1 without vector units)
+uint MiMCSponge_lanesWidth();
+
+// The number of signals of MiMCSponge(nInputs, 220, nOutputs), its Feistels included
+uint MiMCSponge_size(uint nInputs, uint nOutputs);
+
+// Checks the signals computed by the generated template against the native
+// kernel, reporting the first mismatch with the trace of components
+void MiMCSponge_verify(Circom_CalcWit *ctx, uint ctx_index, uint nInputs, uint nOutputs);
+void MiMCSponge_verify_lanes(Circom_CalcWit *ctx, const uint *ctx_indexes, uint nLanes, uint nInputs, uint nOutputs);
+
+#endif // __MIMC_H
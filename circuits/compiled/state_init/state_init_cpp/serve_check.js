@@ -0,0 +1,97 @@
+const { spawn } = require("child_process");
+const { readFileSync, existsSync, unlinkSync } = require("fs");
+const net = require("net");
+
+// Serve regression run of make check: sends the lines of batch_check.jsonl
+// and a document with arrays nested far too deep to a --serve process, one
+// connection each, and checks the status of every answer (the valid even
+// lines 0, the others 1) and that the server is still up at the end. The
+// server runs two workers, and the requests are sent while another
+// connection is stalled in the middle of a request, which the server must
+// close once it times out. A
+// TRUSTED_INPUTS build is checked with --trusted: it answers every line
+// with a witness.
+
+if (process.argv.length != 5 && !(process.argv.length == 6 && process.argv[5] == "--trusted")) {
+    console.log("Usage: node serve_check.js <witness binary> <batch_check.jsonl> <socket> [--trusted]");
+    process.exit(1);
+}
+const [binary, checkFile, socketPath] = process.argv.slice(2);
+const trusted = process.argv.length == 6;
+
+const deep = 1 << 20;
+const requests = readFileSync(checkFile, "utf8").split("\n").filter(line => line.trim() != "")
+    .map((line, i) => ({ name: "line " + i, payload: line, status: trusted ? 0 : i % 2 }));
+requests.push({ name: "deep arrays", payload: "{\"patrol\":" + "[".repeat(deep) + "]".repeat(deep) + "}", status: 1 });
+requests.push(Object.assign({}, requests[0], { name: "line 0 again" }));
+
+function request(payload) {
+    return new Promise((resolve, reject) => {
+        const body = Buffer.from(payload);
+        const head = Buffer.alloc(4);
+        head.writeUInt32LE(body.length);
+        const chunks = [];
+        const socket = net.connect(socketPath, () => socket.end(Buffer.concat([head, body])));
+        socket.setTimeout(20000, () => socket.destroy(new Error("no answer within 20 s")));
+        socket.on("data", chunk => chunks.push(chunk));
+        socket.on("error", reject);
+        socket.on("close", () => {
+            const answer = Buffer.concat(chunks);
+            if (answer.length < 12) return reject(new Error("connection closed without an answer"));
+            resolve({ status: answer.readUInt32LE(0), data: answer.subarray(12, 12 + Number(answer.readBigUInt64LE(4))) });
+        });
+    });
+}
+
+async function waitForSocket(server) {
+    for (let i = 0; i < 600 && server.exitCode === null && server.signalCode === null; i++) {
+        if (existsSync(socketPath)) return;
+        await new Promise(resolve => setTimeout(resolve, 100));
+    }
+    throw new Error("the server did not start");
+}
+
+// Connects and sends half of a request length, then nothing: resolves
+// once the server closes the connection
+function stall() {
+    return new Promise((resolve, reject) => {
+        const socket = net.connect(socketPath, () => socket.write(Buffer.alloc(2)));
+        socket.on("error", reject);
+        socket.on("close", resolve);
+    });
+}
+
+async function run() {
+    if (existsSync(socketPath)) unlinkSync(socketPath);
+    const server = spawn(binary, ["--serve", socketPath, "-j", "2"], { stdio: "inherit" });
+    let failed = 0;
+    try {
+        await waitForSocket(server);
+        const stalled = stall();
+        for (const r of requests) {
+            const answer = await request(r.payload).catch(err => {
+                throw new Error(r.name + ": " + err.message);
+            });
+            const ok = answer.status == r.status && (r.status != 0 || answer.data.subarray(0, 4).toString() == "wtns");
+            if (!ok) failed++;
+            console.log(r.name + ": status " + answer.status + (ok ? "" : ", expected " + r.status)
+                + (answer.status ? " (" + answer.data.toString().split("\n")[0] + ")" : ""));
+        }
+        const timeout = new Promise((resolve, reject) =>
+            setTimeout(() => reject(new Error("the stalled connection is still open")), 20000).unref());
+        await Promise.race([stalled, timeout]);
+        console.log("stalled connection: closed by the server");
+    } catch (err) {
+        console.log(err.message);
+        failed++;
+    }
+    if (server.exitCode !== null || server.signalCode !== null) {
+        console.log("the server exited with " + (server.signalCode || server.exitCode));
+        failed++;
+    }
+    server.kill();
+    if (existsSync(socketPath)) unlinkSync(socketPath);
+    process.exit(failed ? 1 : 0);
+}
+
+run();
@@ -3,63 +3,64 @@
 #include <assert.h>
 #include "circom.hpp"
 #include "calcwit.hpp"
-void RequireBinary_0_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+#include "mimc.hpp"
+void RequireBinary_0_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void RequireBinary_0_run(uint ctx_index,Circom_CalcWit* ctx);
-void Num2Bits_1_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void Num2Bits_1_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void Num2Bits_1_run(uint ctx_index,Circom_CalcWit* ctx);
-void LessThan_2_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void LessThan_2_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void LessThan_2_run(uint ctx_index,Circom_CalcWit* ctx);
-void GreaterEqThan_3_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void GreaterEqThan_3_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void GreaterEqThan_3_run(uint ctx_index,Circom_CalcWit* ctx);
-void LessEqThan_4_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void LessEqThan_4_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void LessEqThan_4_run(uint ctx_index,Circom_CalcWit* ctx);
-void AND_5_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void AND_5_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void AND_5_run(uint ctx_index,Circom_CalcWit* ctx);
-void InInterval_6_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void InInterval_6_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void InInterval_6_run(uint ctx_index,Circom_CalcWit* ctx);
-void CoordToPos_7_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void CoordToPos_7_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void CoordToPos_7_run(uint ctx_index,Circom_CalcWit* ctx);
-void PlaceShip_8_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void PlaceShip_8_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void PlaceShip_8_run(uint ctx_index,Circom_CalcWit* ctx);
-void PlaceShip_9_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void PlaceShip_9_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void PlaceShip_9_run(uint ctx_index,Circom_CalcWit* ctx);
-void PlaceShip_10_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void PlaceShip_10_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void PlaceShip_10_run(uint ctx_index,Circom_CalcWit* ctx);
-void PlaceShip_11_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void PlaceShip_11_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void PlaceShip_11_run(uint ctx_index,Circom_CalcWit* ctx);
-void IsZero_12_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void IsZero_12_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void IsZero_12_run(uint ctx_index,Circom_CalcWit* ctx);
-void IsEqual_13_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void IsEqual_13_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void IsEqual_13_run(uint ctx_index,Circom_CalcWit* ctx);
-void Requrie2DontOverlap_14_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void Requrie2DontOverlap_14_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void Requrie2DontOverlap_14_run(uint ctx_index,Circom_CalcWit* ctx);
-void Requrie2DontOverlap_15_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void Requrie2DontOverlap_15_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void Requrie2DontOverlap_15_run(uint ctx_index,Circom_CalcWit* ctx);
-void Requrie2DontOverlap_16_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void Requrie2DontOverlap_16_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void Requrie2DontOverlap_16_run(uint ctx_index,Circom_CalcWit* ctx);
-void Requrie2DontOverlap_17_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void Requrie2DontOverlap_17_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void Requrie2DontOverlap_17_run(uint ctx_index,Circom_CalcWit* ctx);
-void Requrie2DontOverlap_18_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void Requrie2DontOverlap_18_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void Requrie2DontOverlap_18_run(uint ctx_index,Circom_CalcWit* ctx);
-void Requrie2DontOverlap_19_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void Requrie2DontOverlap_19_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void Requrie2DontOverlap_19_run(uint ctx_index,Circom_CalcWit* ctx);
-void Requrie2DontOverlap_20_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void Requrie2DontOverlap_20_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void Requrie2DontOverlap_20_run(uint ctx_index,Circom_CalcWit* ctx);
-void PlaceFleet_21_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void PlaceFleet_21_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void PlaceFleet_21_run(uint ctx_index,Circom_CalcWit* ctx);
-void FlattenFleet_22_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void FlattenFleet_22_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void FlattenFleet_22_run(uint ctx_index,Circom_CalcWit* ctx);
-void MiMCFeistel_23_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void MiMCFeistel_23_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void MiMCFeistel_23_run(uint ctx_index,Circom_CalcWit* ctx);
-void MiMCSponge_24_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void MiMCSponge_24_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void MiMCSponge_24_run(uint ctx_index,Circom_CalcWit* ctx);
-void HashFleet_25_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void HashFleet_25_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void HashFleet_25_run(uint ctx_index,Circom_CalcWit* ctx);
-void MiMCSponge_26_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void MiMCSponge_26_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void MiMCSponge_26_run(uint ctx_index,Circom_CalcWit* ctx);
-void HashState_27_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void HashState_27_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void HashState_27_run(uint ctx_index,Circom_CalcWit* ctx);
-void InitState_28_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void InitState_28_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void InitState_28_run(uint ctx_index,Circom_CalcWit* ctx);
 Circom_TemplateFunction _functionTable[29] = { 
 RequireBinary_0_run,
@@ -117,7 +118,7 @@ NULL,
 NULL,
 NULL,
 NULL,
-NULL,
+HashFleet_25_run,
 NULL,
 NULL,
 NULL };
@@ -167,7 +168,7 @@ delete []ctx->componentMemory[pos].sbct;
 
 // function declarations
 // template declarations
-void RequireBinary_0_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void RequireBinary_0_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 0;
 ctx->componentMemory[coffset].templateName = "RequireBinary";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -180,8 +181,6 @@ ctx->componentMemory[coffset].subcomponents = new uint[0];
 void RequireBinary_0_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -192,18 +191,16 @@ FrElement expaux[6];
 FrElement lvar[0];
 uint sub_component_aux;
 uint index_multiple_eq;
+#ifndef TRUSTED_INPUTS
 Fr_sub(&expaux[3],&signalValues[mySignalStart + 0],&circuitConstants[0]); // line circom 26
 Fr_mul(&expaux[1],&signalValues[mySignalStart + 0],&expaux[3]); // line circom 26
 Fr_eq(&expaux[0],&expaux[1],&circuitConstants[1]); // line circom 26
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 26. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,26);
 assert(Fr_isTrue(&expaux[0]));
-for (uint i = 0; i < 0; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
+#endif
 }
 
-void Num2Bits_1_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void Num2Bits_1_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 1;
 ctx->componentMemory[coffset].templateName = "Num2Bits";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -216,8 +213,6 @@ ctx->componentMemory[coffset].subcomponents = new uint[0];
 void Num2Bits_1_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -226,81 +221,55 @@ FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[6];
 FrElement lvar[4];
+uint lvar_0, lvar_2, lvar_3;
 uint sub_component_aux;
 uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[2]);
-}
+lvar_0 = 6;
 {
 PFrElement aux_dest = &lvar[1];
 // load src
 // end load src
 Fr_copy(aux_dest,&circuitConstants[1]);
 }
+lvar_2 = 1;
+lvar_3 = 0;
+while(lvar_3 < 6){
 {
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[0]);
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[2]); // line circom 31
-while(Fr_isTrue(&expaux[0])){
-{
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 0)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_3) + 0)];
 // load src
+Fr_fromInt(&lvar[3],lvar_3);
 Fr_shr(&expaux[1],&signalValues[mySignalStart + 6],&lvar[3]); // line circom 32
 Fr_band(&expaux[0],&expaux[1],&circuitConstants[0]); // line circom 32
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
-Fr_sub(&expaux[3],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 0)],&circuitConstants[0]); // line circom 33
-Fr_mul(&expaux[1],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 0)],&expaux[3]); // line circom 33
+#ifndef TRUSTED_INPUTS
+Fr_sub(&expaux[3],&signalValues[mySignalStart + ((1 * lvar_3) + 0)],&circuitConstants[0]); // line circom 33
+Fr_mul(&expaux[1],&signalValues[mySignalStart + ((1 * lvar_3) + 0)],&expaux[3]); // line circom 33
 Fr_eq(&expaux[0],&expaux[1],&circuitConstants[1]); // line circom 33
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 33. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,33);
 assert(Fr_isTrue(&expaux[0]));
+#endif
 {
 PFrElement aux_dest = &lvar[1];
 // load src
-Fr_mul(&expaux[2],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 0)],&lvar[2]); // line circom 34
+Fr_fromInt(&lvar[2],lvar_2);
+Fr_mul(&expaux[2],&signalValues[mySignalStart + ((1 * lvar_3) + 0)],&lvar[2]); // line circom 34
 Fr_add(&expaux[0],&lvar[1],&expaux[2]); // line circom 34
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-Fr_add(&expaux[0],&lvar[2],&lvar[2]); // line circom 35
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[0]); // line circom 31
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[2]); // line circom 31
+lvar_2 = lvar_2 + lvar_2; // line circom 35
+lvar_3 = lvar_3 + 1; // line circom 31
 }
+#ifndef TRUSTED_INPUTS
 Fr_eq(&expaux[0],&lvar[1],&signalValues[mySignalStart + 6]); // line circom 38
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 38. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,38);
 assert(Fr_isTrue(&expaux[0]));
-for (uint i = 0; i < 0; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
+#endif
 }
 
-void LessThan_2_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void LessThan_2_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 2;
 ctx->componentMemory[coffset].templateName = "LessThan";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -308,13 +277,23 @@ ctx->componentMemory[coffset].inputCounter = 2;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[1]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+3;
+for (uint i = 0; i < 1; i++) {
+Circom_ComponentName new_cmp_name = {"n2b", NULL, 0, 0};
+Num2Bits_1_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 7 ;
+aux_cmp_num += 1;
+}
+}
 }
 
 void LessThan_2_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -322,29 +301,14 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[4];
-FrElement lvar[1];
+uint lvar_0;
 uint sub_component_aux;
 uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[3]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+3;
-for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "n2b";
-Num2Bits_1_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 7 ;
-aux_cmp_num += 1;
-}
-}
-if (!Fr_isTrue(&circuitConstants[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 90. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+lvar_0 = 5;
+#ifndef TRUSTED_INPUTS
+if (!Fr_isTrue(&circuitConstants[0])) ctx->failedAssert(myId,90);
 assert(Fr_isTrue(&circuitConstants[0]));
+#endif
 {
 uint cmp_index_ref = 0;
 {
@@ -366,13 +330,9 @@ Fr_sub(&expaux[0],&circuitConstants[0],&ctx->signalValues[ctx->componentMemory[m
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
-for (uint i = 0; i < 1; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void GreaterEqThan_3_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void GreaterEqThan_3_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 3;
 ctx->componentMemory[coffset].templateName = "GreaterEqThan";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -380,13 +340,23 @@ ctx->componentMemory[coffset].inputCounter = 2;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[1]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+3;
+for (uint i = 0; i < 1; i++) {
+Circom_ComponentName new_cmp_name = {"lt", NULL, 0, 0};
+LessThan_2_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 10 ;
+aux_cmp_num += 2;
+}
+}
 }
 
 void GreaterEqThan_3_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -394,27 +364,10 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[3];
-FrElement lvar[1];
+uint lvar_0;
 uint sub_component_aux;
 uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[3]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+3;
-for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "lt";
-LessThan_2_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 10 ;
-aux_cmp_num += 2;
-}
-}
+lvar_0 = 5;
 {
 uint cmp_index_ref = 0;
 {
@@ -445,13 +398,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[0]].signalStart + 0]);
 }
-for (uint i = 0; i < 1; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void LessEqThan_4_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void LessEqThan_4_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 4;
 ctx->componentMemory[coffset].templateName = "LessEqThan";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -459,13 +408,23 @@ ctx->componentMemory[coffset].inputCounter = 2;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[1]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+3;
+for (uint i = 0; i < 1; i++) {
+Circom_ComponentName new_cmp_name = {"lt", NULL, 0, 0};
+LessThan_2_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 10 ;
+aux_cmp_num += 2;
+}
+}
 }
 
 void LessEqThan_4_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -473,27 +432,10 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[3];
-FrElement lvar[1];
+uint lvar_0;
 uint sub_component_aux;
 uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[3]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+3;
-for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "lt";
-LessThan_2_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 10 ;
-aux_cmp_num += 2;
-}
-}
+lvar_0 = 5;
 {
 uint cmp_index_ref = 0;
 {
@@ -524,13 +466,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[0]].signalStart + 0]);
 }
-for (uint i = 0; i < 1; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void AND_5_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void AND_5_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 5;
 ctx->componentMemory[coffset].templateName = "AND";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -543,8 +481,6 @@ ctx->componentMemory[coffset].subcomponents = new uint[0];
 void AND_5_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -562,13 +498,9 @@ Fr_mul(&expaux[0],&signalValues[mySignalStart + 1],&signalValues[mySignalStart +
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
-for (uint i = 0; i < 0; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void InInterval_6_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void InInterval_6_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 6;
 ctx->componentMemory[coffset].templateName = "InInterval";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -576,105 +508,90 @@ ctx->componentMemory[coffset].inputCounter = 3;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[5]{0};
-}
-
-void InInterval_6_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[2];
-FrElement lvar[3];
-uint sub_component_aux;
-uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[0]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[3]);
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[0]);
-}
 {
 uint aux_create = 0;
-int aux_cmp_num = 1+ctx_index+1;
-uint csoffset = mySignalStart+9;
+int aux_cmp_num = 1+coffset+1;
+uint csoffset = soffset+9;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "GreaterEqThan_56_1695";
-GreaterEqThan_3_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"GreaterEqThan_56_1695", NULL, 0, 0};
+GreaterEqThan_3_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 13 ;
 aux_cmp_num += 3;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 4+ctx_index+1;
-uint csoffset = mySignalStart+22;
+int aux_cmp_num = 4+coffset+1;
+uint csoffset = soffset+22;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "LessEqThan_65_1936";
-LessEqThan_4_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"LessEqThan_65_1936", NULL, 0, 0};
+LessEqThan_4_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 13 ;
 aux_cmp_num += 3;
 }
 }
 {
 uint aux_create = 2;
-int aux_cmp_num = 7+ctx_index+1;
-uint csoffset = mySignalStart+35;
+int aux_cmp_num = 7+coffset+1;
+uint csoffset = soffset+35;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "RequireBinary_72_2085";
-RequireBinary_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"RequireBinary_72_2085", NULL, 0, 0};
+RequireBinary_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 1 ;
 aux_cmp_num += 1;
 }
 }
 {
 uint aux_create = 3;
-int aux_cmp_num = 8+ctx_index+1;
-uint csoffset = mySignalStart+36;
+int aux_cmp_num = 8+coffset+1;
+uint csoffset = soffset+36;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "RequireBinary_73_2116";
-RequireBinary_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"RequireBinary_73_2116", NULL, 0, 0};
+RequireBinary_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 1 ;
 aux_cmp_num += 1;
 }
 }
 {
 uint aux_create = 4;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+6;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+6;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "AND_74_2155";
-AND_5_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"AND_74_2155", NULL, 0, 0};
+AND_5_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 3 ;
 aux_cmp_num += 1;
 }
 }
-if (!Fr_isTrue(&circuitConstants[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 50. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+}
+
+void InInterval_6_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[2];
+uint lvar_0, lvar_1, lvar_2;
+uint sub_component_aux;
+uint index_multiple_eq;
+lvar_0 = 1;
+lvar_1 = 5;
+lvar_2 = 1;
+#ifndef TRUSTED_INPUTS
+if (!Fr_isTrue(&circuitConstants[0])) ctx->failedAssert(myId,50);
 assert(Fr_isTrue(&circuitConstants[0]));
-if (!Fr_isTrue(&circuitConstants[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 51. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+if (!Fr_isTrue(&circuitConstants[0])) ctx->failedAssert(myId,51);
 assert(Fr_isTrue(&circuitConstants[0]));
+#endif
 {
 uint cmp_index_ref = 0;
 {
@@ -786,13 +703,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[4]].signalStart + 0]);
 }
-for (uint i = 0; i < 5; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void CoordToPos_7_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void CoordToPos_7_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 7;
 ctx->componentMemory[coffset].templateName = "CoordToPos";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -800,13 +713,35 @@ ctx->componentMemory[coffset].inputCounter = 2;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[2]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+5;
+for (uint i = 0; i < 1; i++) {
+Circom_ComponentName new_cmp_name = {"InInterval_28_758", NULL, 0, 0};
+InInterval_6_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 37 ;
+aux_cmp_num += 10;
+}
+}
+{
+uint aux_create = 1;
+int aux_cmp_num = 10+coffset+1;
+uint csoffset = soffset+42;
+for (uint i = 0; i < 1; i++) {
+Circom_ComponentName new_cmp_name = {"InInterval_30_831", NULL, 0, 0};
+InInterval_6_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 37 ;
+aux_cmp_num += 10;
+}
+}
 }
 
 void CoordToPos_7_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -818,30 +753,6 @@ FrElement lvar[0];
 uint sub_component_aux;
 uint index_multiple_eq;
 {
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+5;
-for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "InInterval_28_758";
-InInterval_6_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 37 ;
-aux_cmp_num += 10;
-}
-}
-{
-uint aux_create = 1;
-int aux_cmp_num = 10+ctx_index+1;
-uint csoffset = mySignalStart+42;
-for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "InInterval_30_831";
-InInterval_6_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 37 ;
-aux_cmp_num += 10;
-}
-}
-{
 uint cmp_index_ref = 0;
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
@@ -881,9 +792,11 @@ PFrElement aux_dest = &signalValues[mySignalStart + 3];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[0]].signalStart + 0]);
 }
+#ifndef TRUSTED_INPUTS
 Fr_eq(&expaux[0],&signalValues[mySignalStart + 3],&circuitConstants[0]); // line circom 29
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 29. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,29);
 assert(Fr_isTrue(&expaux[0]));
+#endif
 {
 uint cmp_index_ref = 1;
 {
@@ -924,9 +837,11 @@ PFrElement aux_dest = &signalValues[mySignalStart + 4];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[1]].signalStart + 0]);
 }
+#ifndef TRUSTED_INPUTS
 Fr_eq(&expaux[0],&signalValues[mySignalStart + 4],&circuitConstants[0]); // line circom 31
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 31. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,31);
 assert(Fr_isTrue(&expaux[0]));
+#endif
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // load src
@@ -936,13 +851,9 @@ Fr_add(&expaux[0],&signalValues[mySignalStart + 1],&expaux[2]); // line circom 3
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
-for (uint i = 0; i < 2; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void PlaceShip_8_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void PlaceShip_8_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 8;
 ctx->componentMemory[coffset].templateName = "PlaceShip";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -950,62 +861,53 @@ ctx->componentMemory[coffset].inputCounter = 3;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[3]{0};
-}
-
-void PlaceShip_8_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[6];
-FrElement lvar[3];
-uint sub_component_aux;
-uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[6]);
-}
 {
 uint aux_create = 0;
-int aux_cmp_num = 42+ctx_index+1;
-uint csoffset = mySignalStart+166;
+int aux_cmp_num = 42+coffset+1;
+uint csoffset = soffset+166;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "RequireBinary_60_1765";
-RequireBinary_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"RequireBinary_60_1765", NULL, 0, 0};
+RequireBinary_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 1 ;
 aux_cmp_num += 1;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+8;
-uint aux_dimensions[1] = {2};
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+8;
+static const uint aux_dimensions[1] = {2};
 for (uint i = 0; i < 2; i++) {
-std::string new_cmp_name = "CoordToPos_64_1944"+ctx->generate_position_array(aux_dimensions, 1, i);
-CoordToPos_7_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"CoordToPos_64_1944", aux_dimensions, 1, i};
+CoordToPos_7_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 79 ;
 aux_cmp_num += 21;
 }
 }
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
 }
-if (!Fr_isTrue(&circuitConstants[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 55. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+
+void PlaceShip_8_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[6];
+FrElement lvar[3];
+uint lvar_0, lvar_1, lvar_2;
+uint sub_component_aux;
+uint index_multiple_eq;
+lvar_0 = 2;
+lvar_1 = 0;
+#ifndef TRUSTED_INPUTS
+if (!Fr_isTrue(&circuitConstants[0])) ctx->failedAssert(myId,55);
 assert(Fr_isTrue(&circuitConstants[0]));
+#endif
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 5];
 // load src
@@ -1036,19 +938,14 @@ Fr_copy(aux_dest,&signalValues[mySignalStart + 7]);
 assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1));
 RequireBinary_0_run(mySubcomponents[cmp_index_ref],ctx);
 }
+lvar_2 = 0;
+while(lvar_2 < 2){
 {
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[6]); // line circom 63
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[1])) + 1);
+uint cmp_index_ref = ((1 * lvar_1) + 1);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
+Fr_fromInt(&lvar[2],lvar_2);
 Fr_mul(&expaux[2],&signalValues[mySignalStart + 7],&lvar[2]); // line circom 65
 Fr_add(&expaux[0],&signalValues[mySignalStart + 5],&expaux[2]); // line circom 65
 // end load src
@@ -1061,11 +958,12 @@ CoordToPos_7_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[1])) + 1);
+uint cmp_index_ref = ((1 * lvar_1) + 1);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
 Fr_sub(&expaux[3],&circuitConstants[0],&signalValues[mySignalStart + 7]); // line circom 66
+Fr_fromInt(&lvar[2],lvar_2);
 Fr_mul(&expaux[2],&expaux[3],&lvar[2]); // line circom 66
 Fr_add(&expaux[0],&signalValues[mySignalStart + 6],&expaux[2]); // line circom 66
 // end load src
@@ -1078,34 +976,17 @@ CoordToPos_7_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[2])) + 0)];
-// load src
-// end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * Fr_toInt(&lvar[1])) + 1)]].signalStart + 0]);
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-Fr_add(&expaux[0],&lvar[2],&circuitConstants[0]); // line circom 63
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-{
-PFrElement aux_dest = &lvar[1];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_2) + 0)];
 // load src
-Fr_add(&expaux[0],&lvar[1],&circuitConstants[0]); // line circom 63
 // end load src
-Fr_copy(aux_dest,&expaux[0]);
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * lvar_1) + 1)]].signalStart + 0]);
 }
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[6]); // line circom 63
-}
-for (uint i = 0; i < 3; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_2 = lvar_2 + 1; // line circom 63
+lvar_1 = lvar_1 + 1; // line circom 63
 }
 }
 
-void PlaceShip_9_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void PlaceShip_9_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 9;
 ctx->componentMemory[coffset].templateName = "PlaceShip";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -1113,62 +994,53 @@ ctx->componentMemory[coffset].inputCounter = 3;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[4]{0};
-}
-
-void PlaceShip_9_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[6];
-FrElement lvar[3];
-uint sub_component_aux;
-uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[7]);
-}
 {
 uint aux_create = 0;
-int aux_cmp_num = 63+ctx_index+1;
-uint csoffset = mySignalStart+246;
+int aux_cmp_num = 63+coffset+1;
+uint csoffset = soffset+246;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "RequireBinary_60_1765";
-RequireBinary_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"RequireBinary_60_1765", NULL, 0, 0};
+RequireBinary_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 1 ;
 aux_cmp_num += 1;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+9;
-uint aux_dimensions[1] = {3};
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+9;
+static const uint aux_dimensions[1] = {3};
 for (uint i = 0; i < 3; i++) {
-std::string new_cmp_name = "CoordToPos_64_1944"+ctx->generate_position_array(aux_dimensions, 1, i);
-CoordToPos_7_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"CoordToPos_64_1944", aux_dimensions, 1, i};
+CoordToPos_7_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 79 ;
 aux_cmp_num += 21;
 }
 }
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
 }
-if (!Fr_isTrue(&circuitConstants[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 55. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+
+void PlaceShip_9_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[6];
+FrElement lvar[3];
+uint lvar_0, lvar_1, lvar_2;
+uint sub_component_aux;
+uint index_multiple_eq;
+lvar_0 = 3;
+lvar_1 = 0;
+#ifndef TRUSTED_INPUTS
+if (!Fr_isTrue(&circuitConstants[0])) ctx->failedAssert(myId,55);
 assert(Fr_isTrue(&circuitConstants[0]));
+#endif
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 6];
 // load src
@@ -1199,19 +1071,14 @@ Fr_copy(aux_dest,&signalValues[mySignalStart + 8]);
 assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1));
 RequireBinary_0_run(mySubcomponents[cmp_index_ref],ctx);
 }
+lvar_2 = 0;
+while(lvar_2 < 3){
+{
+uint cmp_index_ref = ((1 * lvar_1) + 1);
 {
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[7]); // line circom 63
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[1])) + 1);
-{
-PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
+PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
+Fr_fromInt(&lvar[2],lvar_2);
 Fr_mul(&expaux[2],&signalValues[mySignalStart + 8],&lvar[2]); // line circom 65
 Fr_add(&expaux[0],&signalValues[mySignalStart + 6],&expaux[2]); // line circom 65
 // end load src
@@ -1224,11 +1091,12 @@ CoordToPos_7_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[1])) + 1);
+uint cmp_index_ref = ((1 * lvar_1) + 1);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
 Fr_sub(&expaux[3],&circuitConstants[0],&signalValues[mySignalStart + 8]); // line circom 66
+Fr_fromInt(&lvar[2],lvar_2);
 Fr_mul(&expaux[2],&expaux[3],&lvar[2]); // line circom 66
 Fr_add(&expaux[0],&signalValues[mySignalStart + 7],&expaux[2]); // line circom 66
 // end load src
@@ -1241,34 +1109,17 @@ CoordToPos_7_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[2])) + 0)];
-// load src
-// end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * Fr_toInt(&lvar[1])) + 1)]].signalStart + 0]);
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-Fr_add(&expaux[0],&lvar[2],&circuitConstants[0]); // line circom 63
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-{
-PFrElement aux_dest = &lvar[1];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_2) + 0)];
 // load src
-Fr_add(&expaux[0],&lvar[1],&circuitConstants[0]); // line circom 63
 // end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[7]); // line circom 63
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * lvar_1) + 1)]].signalStart + 0]);
 }
-for (uint i = 0; i < 4; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_2 = lvar_2 + 1; // line circom 63
+lvar_1 = lvar_1 + 1; // line circom 63
 }
 }
 
-void PlaceShip_10_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void PlaceShip_10_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 10;
 ctx->componentMemory[coffset].templateName = "PlaceShip";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -1276,62 +1127,53 @@ ctx->componentMemory[coffset].inputCounter = 3;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[5]{0};
-}
-
-void PlaceShip_10_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[6];
-FrElement lvar[3];
-uint sub_component_aux;
-uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[8]);
-}
 {
 uint aux_create = 0;
-int aux_cmp_num = 84+ctx_index+1;
-uint csoffset = mySignalStart+326;
+int aux_cmp_num = 84+coffset+1;
+uint csoffset = soffset+326;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "RequireBinary_60_1765";
-RequireBinary_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"RequireBinary_60_1765", NULL, 0, 0};
+RequireBinary_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 1 ;
 aux_cmp_num += 1;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+10;
-uint aux_dimensions[1] = {4};
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+10;
+static const uint aux_dimensions[1] = {4};
 for (uint i = 0; i < 4; i++) {
-std::string new_cmp_name = "CoordToPos_64_1944"+ctx->generate_position_array(aux_dimensions, 1, i);
-CoordToPos_7_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"CoordToPos_64_1944", aux_dimensions, 1, i};
+CoordToPos_7_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 79 ;
 aux_cmp_num += 21;
 }
 }
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
 }
-if (!Fr_isTrue(&circuitConstants[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 55. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+
+void PlaceShip_10_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[6];
+FrElement lvar[3];
+uint lvar_0, lvar_1, lvar_2;
+uint sub_component_aux;
+uint index_multiple_eq;
+lvar_0 = 4;
+lvar_1 = 0;
+#ifndef TRUSTED_INPUTS
+if (!Fr_isTrue(&circuitConstants[0])) ctx->failedAssert(myId,55);
 assert(Fr_isTrue(&circuitConstants[0]));
+#endif
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 7];
 // load src
@@ -1362,19 +1204,14 @@ Fr_copy(aux_dest,&signalValues[mySignalStart + 9]);
 assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1));
 RequireBinary_0_run(mySubcomponents[cmp_index_ref],ctx);
 }
+lvar_2 = 0;
+while(lvar_2 < 4){
 {
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[8]); // line circom 63
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[1])) + 1);
+uint cmp_index_ref = ((1 * lvar_1) + 1);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
+Fr_fromInt(&lvar[2],lvar_2);
 Fr_mul(&expaux[2],&signalValues[mySignalStart + 9],&lvar[2]); // line circom 65
 Fr_add(&expaux[0],&signalValues[mySignalStart + 7],&expaux[2]); // line circom 65
 // end load src
@@ -1387,11 +1224,12 @@ CoordToPos_7_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[1])) + 1);
+uint cmp_index_ref = ((1 * lvar_1) + 1);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
 Fr_sub(&expaux[3],&circuitConstants[0],&signalValues[mySignalStart + 9]); // line circom 66
+Fr_fromInt(&lvar[2],lvar_2);
 Fr_mul(&expaux[2],&expaux[3],&lvar[2]); // line circom 66
 Fr_add(&expaux[0],&signalValues[mySignalStart + 8],&expaux[2]); // line circom 66
 // end load src
@@ -1404,34 +1242,17 @@ CoordToPos_7_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[2])) + 0)];
-// load src
-// end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * Fr_toInt(&lvar[1])) + 1)]].signalStart + 0]);
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-Fr_add(&expaux[0],&lvar[2],&circuitConstants[0]); // line circom 63
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-{
-PFrElement aux_dest = &lvar[1];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_2) + 0)];
 // load src
-Fr_add(&expaux[0],&lvar[1],&circuitConstants[0]); // line circom 63
 // end load src
-Fr_copy(aux_dest,&expaux[0]);
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * lvar_1) + 1)]].signalStart + 0]);
 }
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[8]); // line circom 63
-}
-for (uint i = 0; i < 5; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_2 = lvar_2 + 1; // line circom 63
+lvar_1 = lvar_1 + 1; // line circom 63
 }
 }
 
-void PlaceShip_11_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void PlaceShip_11_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 11;
 ctx->componentMemory[coffset].templateName = "PlaceShip";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -1439,62 +1260,53 @@ ctx->componentMemory[coffset].inputCounter = 3;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[6]{0};
-}
-
-void PlaceShip_11_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[6];
-FrElement lvar[3];
-uint sub_component_aux;
-uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[3]);
-}
 {
 uint aux_create = 0;
-int aux_cmp_num = 105+ctx_index+1;
-uint csoffset = mySignalStart+406;
+int aux_cmp_num = 105+coffset+1;
+uint csoffset = soffset+406;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "RequireBinary_60_1765";
-RequireBinary_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"RequireBinary_60_1765", NULL, 0, 0};
+RequireBinary_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 1 ;
 aux_cmp_num += 1;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+11;
-uint aux_dimensions[1] = {5};
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+11;
+static const uint aux_dimensions[1] = {5};
 for (uint i = 0; i < 5; i++) {
-std::string new_cmp_name = "CoordToPos_64_1944"+ctx->generate_position_array(aux_dimensions, 1, i);
-CoordToPos_7_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"CoordToPos_64_1944", aux_dimensions, 1, i};
+CoordToPos_7_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 79 ;
 aux_cmp_num += 21;
 }
 }
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
 }
-if (!Fr_isTrue(&circuitConstants[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 55. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+
+void PlaceShip_11_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[6];
+FrElement lvar[3];
+uint lvar_0, lvar_1, lvar_2;
+uint sub_component_aux;
+uint index_multiple_eq;
+lvar_0 = 5;
+lvar_1 = 0;
+#ifndef TRUSTED_INPUTS
+if (!Fr_isTrue(&circuitConstants[0])) ctx->failedAssert(myId,55);
 assert(Fr_isTrue(&circuitConstants[0]));
+#endif
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 8];
 // load src
@@ -1525,19 +1337,14 @@ Fr_copy(aux_dest,&signalValues[mySignalStart + 10]);
 assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1));
 RequireBinary_0_run(mySubcomponents[cmp_index_ref],ctx);
 }
+lvar_2 = 0;
+while(lvar_2 < 5){
 {
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[3]); // line circom 63
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[1])) + 1);
+uint cmp_index_ref = ((1 * lvar_1) + 1);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
+Fr_fromInt(&lvar[2],lvar_2);
 Fr_mul(&expaux[2],&signalValues[mySignalStart + 10],&lvar[2]); // line circom 65
 Fr_add(&expaux[0],&signalValues[mySignalStart + 8],&expaux[2]); // line circom 65
 // end load src
@@ -1550,11 +1357,12 @@ CoordToPos_7_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[1])) + 1);
+uint cmp_index_ref = ((1 * lvar_1) + 1);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
 Fr_sub(&expaux[3],&circuitConstants[0],&signalValues[mySignalStart + 10]); // line circom 66
+Fr_fromInt(&lvar[2],lvar_2);
 Fr_mul(&expaux[2],&expaux[3],&lvar[2]); // line circom 66
 Fr_add(&expaux[0],&signalValues[mySignalStart + 9],&expaux[2]); // line circom 66
 // end load src
@@ -1567,34 +1375,17 @@ CoordToPos_7_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[2])) + 0)];
-// load src
-// end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * Fr_toInt(&lvar[1])) + 1)]].signalStart + 0]);
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-Fr_add(&expaux[0],&lvar[2],&circuitConstants[0]); // line circom 63
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-{
-PFrElement aux_dest = &lvar[1];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_2) + 0)];
 // load src
-Fr_add(&expaux[0],&lvar[1],&circuitConstants[0]); // line circom 63
 // end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[3]); // line circom 63
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * lvar_1) + 1)]].signalStart + 0]);
 }
-for (uint i = 0; i < 6; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_2 = lvar_2 + 1; // line circom 63
+lvar_1 = lvar_1 + 1; // line circom 63
 }
 }
 
-void IsZero_12_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void IsZero_12_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 12;
 ctx->componentMemory[coffset].templateName = "IsZero";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -1607,8 +1398,6 @@ ctx->componentMemory[coffset].subcomponents = new uint[0];
 void IsZero_12_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -1619,43 +1408,26 @@ FrElement expaux[4];
 FrElement lvar[0];
 uint sub_component_aux;
 uint index_multiple_eq;
-Fr_neq(&expaux[0],&signalValues[mySignalStart + 1],&circuitConstants[1]); // line circom 30
-if(Fr_isTrue(&expaux[0])){
-{
-PFrElement aux_dest = &signalValues[mySignalStart + 2];
-// load src
-Fr_div(&expaux[0],&circuitConstants[0],&signalValues[mySignalStart + 1]); // line circom 30
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-}else{
-{
-PFrElement aux_dest = &signalValues[mySignalStart + 2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-}
+// inv is only read back by the witness: inverted with the others after the run,
+// which gives 0 for in == 0 without a branch on the input
+ctx->deferInverse(&signalValues[mySignalStart + 2],&signalValues[mySignalStart + 1]); // line circom 30
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // load src
-Fr_neg(&expaux[2],&signalValues[mySignalStart + 1]); // line circom 32
-Fr_mul(&expaux[1],&expaux[2],&signalValues[mySignalStart + 2]); // line circom 32
-Fr_add(&expaux[0],&expaux[1],&circuitConstants[0]); // line circom 32
+// -in*inv + 1 is in == 0, without the deferred inv
+Fr_eq(&expaux[0],&signalValues[mySignalStart + 1],&circuitConstants[1]); // line circom 32
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
+#ifndef TRUSTED_INPUTS
 Fr_mul(&expaux[1],&signalValues[mySignalStart + 1],&signalValues[mySignalStart + 0]); // line circom 33
 Fr_eq(&expaux[0],&expaux[1],&circuitConstants[1]); // line circom 33
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 33. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,33);
 assert(Fr_isTrue(&expaux[0]));
-for (uint i = 0; i < 0; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
+#endif
 }
 
-void IsEqual_13_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void IsEqual_13_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 13;
 ctx->componentMemory[coffset].templateName = "IsEqual";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -1663,13 +1435,23 @@ ctx->componentMemory[coffset].inputCounter = 2;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[1]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+3;
+for (uint i = 0; i < 1; i++) {
+Circom_ComponentName new_cmp_name = {"isz", NULL, 0, 0};
+IsZero_12_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 3 ;
+aux_cmp_num += 1;
+}
+}
 }
 
 void IsEqual_13_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -1681,18 +1463,6 @@ FrElement lvar[0];
 uint sub_component_aux;
 uint index_multiple_eq;
 {
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+3;
-for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "isz";
-IsZero_12_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 3 ;
-aux_cmp_num += 1;
-}
-}
-{
 uint cmp_index_ref = 0;
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
@@ -1711,13 +1481,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[0]].signalStart + 0]);
 }
-for (uint i = 0; i < 1; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void Requrie2DontOverlap_14_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void Requrie2DontOverlap_14_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 14;
 ctx->componentMemory[coffset].templateName = "Requrie2DontOverlap";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -1725,13 +1491,24 @@ ctx->componentMemory[coffset].inputCounter = 5;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[6]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+5;
+static const uint aux_dimensions[2] = {2,3};
+for (uint i = 0; i < 6; i++) {
+Circom_ComponentName new_cmp_name = {"Eqs", aux_dimensions, 2, i};
+IsEqual_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 6 ;
+aux_cmp_num += 2;
+}
+}
 }
 
 void Requrie2DontOverlap_14_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -1739,57 +1516,22 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[3];
-FrElement lvar[4];
+uint lvar_0, lvar_1, lvar_2, lvar_3;
 uint sub_component_aux;
 uint index_multiple_eq;
+lvar_0 = 2;
+lvar_1 = 3;
+lvar_2 = 0;
+while(lvar_2 < 2){
+lvar_3 = 0;
+while(lvar_3 < 3){
 {
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[6]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[7]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+5;
-uint aux_dimensions[2] = {2,3};
-for (uint i = 0; i < 6; i++) {
-std::string new_cmp_name = "Eqs"+ctx->generate_position_array(aux_dimensions, 2, i);
-IsEqual_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 6 ;
-aux_cmp_num += 2;
-}
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[6]); // line circom 90
-while(Fr_isTrue(&expaux[0])){
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[7]); // line circom 91
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = (((3 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0);
+uint cmp_index_ref = (((3 * lvar_2) + (1 * lvar_3)) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[2])) + 0)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_2) + 0)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -1798,12 +1540,12 @@ IsEqual_13_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = (((3 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0);
+uint cmp_index_ref = (((3 * lvar_2) + (1 * lvar_3)) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 2)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_3) + 2)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -1811,34 +1553,18 @@ IsEqual_13_run(mySubcomponents[cmp_index_ref],ctx);
 
 }
 }
-Fr_eq(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[(((3 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0)]].signalStart + 0],&circuitConstants[1]); // line circom 94
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 94. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+#ifndef TRUSTED_INPUTS
+Fr_eq(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[(((3 * lvar_2) + (1 * lvar_3)) + 0)]].signalStart + 0],&circuitConstants[1]); // line circom 94
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,94);
 assert(Fr_isTrue(&expaux[0]));
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[0]); // line circom 91
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[7]); // line circom 91
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-Fr_add(&expaux[0],&lvar[2],&circuitConstants[0]); // line circom 90
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
+#endif
+lvar_3 = lvar_3 + 1; // line circom 91
 }
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[6]); // line circom 90
-}
-for (uint i = 0; i < 6; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_2 = lvar_2 + 1; // line circom 90
 }
 }
 
-void Requrie2DontOverlap_15_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void Requrie2DontOverlap_15_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 15;
 ctx->componentMemory[coffset].templateName = "Requrie2DontOverlap";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -1846,13 +1572,24 @@ ctx->componentMemory[coffset].inputCounter = 6;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[8]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+6;
+static const uint aux_dimensions[2] = {2,4};
+for (uint i = 0; i < 8; i++) {
+Circom_ComponentName new_cmp_name = {"Eqs", aux_dimensions, 2, i};
+IsEqual_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 6 ;
+aux_cmp_num += 2;
+}
+}
 }
 
 void Requrie2DontOverlap_15_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -1860,57 +1597,22 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[3];
-FrElement lvar[4];
+uint lvar_0, lvar_1, lvar_2, lvar_3;
 uint sub_component_aux;
 uint index_multiple_eq;
+lvar_0 = 2;
+lvar_1 = 4;
+lvar_2 = 0;
+while(lvar_2 < 2){
+lvar_3 = 0;
+while(lvar_3 < 4){
 {
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[6]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[8]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+6;
-uint aux_dimensions[2] = {2,4};
-for (uint i = 0; i < 8; i++) {
-std::string new_cmp_name = "Eqs"+ctx->generate_position_array(aux_dimensions, 2, i);
-IsEqual_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 6 ;
-aux_cmp_num += 2;
-}
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[6]); // line circom 90
-while(Fr_isTrue(&expaux[0])){
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[8]); // line circom 91
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = (((4 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0);
+uint cmp_index_ref = (((4 * lvar_2) + (1 * lvar_3)) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[2])) + 0)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_2) + 0)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -1919,12 +1621,12 @@ IsEqual_13_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = (((4 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0);
+uint cmp_index_ref = (((4 * lvar_2) + (1 * lvar_3)) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 2)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_3) + 2)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -1932,34 +1634,18 @@ IsEqual_13_run(mySubcomponents[cmp_index_ref],ctx);
 
 }
 }
-Fr_eq(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[(((4 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0)]].signalStart + 0],&circuitConstants[1]); // line circom 94
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 94. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+#ifndef TRUSTED_INPUTS
+Fr_eq(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[(((4 * lvar_2) + (1 * lvar_3)) + 0)]].signalStart + 0],&circuitConstants[1]); // line circom 94
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,94);
 assert(Fr_isTrue(&expaux[0]));
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[0]); // line circom 91
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[8]); // line circom 91
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-Fr_add(&expaux[0],&lvar[2],&circuitConstants[0]); // line circom 90
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[6]); // line circom 90
+#endif
+lvar_3 = lvar_3 + 1; // line circom 91
 }
-for (uint i = 0; i < 8; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_2 = lvar_2 + 1; // line circom 90
 }
 }
 
-void Requrie2DontOverlap_16_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void Requrie2DontOverlap_16_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 16;
 ctx->componentMemory[coffset].templateName = "Requrie2DontOverlap";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -1967,13 +1653,24 @@ ctx->componentMemory[coffset].inputCounter = 7;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[10]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+7;
+static const uint aux_dimensions[2] = {2,5};
+for (uint i = 0; i < 10; i++) {
+Circom_ComponentName new_cmp_name = {"Eqs", aux_dimensions, 2, i};
+IsEqual_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 6 ;
+aux_cmp_num += 2;
+}
+}
 }
 
 void Requrie2DontOverlap_16_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -1981,57 +1678,22 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[3];
-FrElement lvar[4];
+uint lvar_0, lvar_1, lvar_2, lvar_3;
 uint sub_component_aux;
 uint index_multiple_eq;
+lvar_0 = 2;
+lvar_1 = 5;
+lvar_2 = 0;
+while(lvar_2 < 2){
+lvar_3 = 0;
+while(lvar_3 < 5){
 {
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[6]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[3]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+7;
-uint aux_dimensions[2] = {2,5};
-for (uint i = 0; i < 10; i++) {
-std::string new_cmp_name = "Eqs"+ctx->generate_position_array(aux_dimensions, 2, i);
-IsEqual_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 6 ;
-aux_cmp_num += 2;
-}
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[6]); // line circom 90
-while(Fr_isTrue(&expaux[0])){
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 91
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = (((5 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0);
+uint cmp_index_ref = (((5 * lvar_2) + (1 * lvar_3)) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[2])) + 0)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_2) + 0)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2040,12 +1702,12 @@ IsEqual_13_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = (((5 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0);
+uint cmp_index_ref = (((5 * lvar_2) + (1 * lvar_3)) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 2)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_3) + 2)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2053,34 +1715,18 @@ IsEqual_13_run(mySubcomponents[cmp_index_ref],ctx);
 
 }
 }
-Fr_eq(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[(((5 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0)]].signalStart + 0],&circuitConstants[1]); // line circom 94
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 94. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+#ifndef TRUSTED_INPUTS
+Fr_eq(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[(((5 * lvar_2) + (1 * lvar_3)) + 0)]].signalStart + 0],&circuitConstants[1]); // line circom 94
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,94);
 assert(Fr_isTrue(&expaux[0]));
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[0]); // line circom 91
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 91
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-Fr_add(&expaux[0],&lvar[2],&circuitConstants[0]); // line circom 90
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
+#endif
+lvar_3 = lvar_3 + 1; // line circom 91
 }
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[6]); // line circom 90
-}
-for (uint i = 0; i < 10; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_2 = lvar_2 + 1; // line circom 90
 }
 }
 
-void Requrie2DontOverlap_17_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void Requrie2DontOverlap_17_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 17;
 ctx->componentMemory[coffset].templateName = "Requrie2DontOverlap";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2088,13 +1734,24 @@ ctx->componentMemory[coffset].inputCounter = 6;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[9]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+6;
+static const uint aux_dimensions[2] = {3,3};
+for (uint i = 0; i < 9; i++) {
+Circom_ComponentName new_cmp_name = {"Eqs", aux_dimensions, 2, i};
+IsEqual_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 6 ;
+aux_cmp_num += 2;
+}
+}
 }
 
 void Requrie2DontOverlap_17_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -2102,57 +1759,22 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[3];
-FrElement lvar[4];
+uint lvar_0, lvar_1, lvar_2, lvar_3;
 uint sub_component_aux;
 uint index_multiple_eq;
+lvar_0 = 3;
+lvar_1 = 3;
+lvar_2 = 0;
+while(lvar_2 < 3){
+lvar_3 = 0;
+while(lvar_3 < 3){
 {
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[7]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[7]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+6;
-uint aux_dimensions[2] = {3,3};
-for (uint i = 0; i < 9; i++) {
-std::string new_cmp_name = "Eqs"+ctx->generate_position_array(aux_dimensions, 2, i);
-IsEqual_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 6 ;
-aux_cmp_num += 2;
-}
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[7]); // line circom 90
-while(Fr_isTrue(&expaux[0])){
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[7]); // line circom 91
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = (((3 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0);
+uint cmp_index_ref = (((3 * lvar_2) + (1 * lvar_3)) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[2])) + 0)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_2) + 0)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2161,12 +1783,12 @@ IsEqual_13_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = (((3 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0);
+uint cmp_index_ref = (((3 * lvar_2) + (1 * lvar_3)) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 3)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_3) + 3)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2174,34 +1796,18 @@ IsEqual_13_run(mySubcomponents[cmp_index_ref],ctx);
 
 }
 }
-Fr_eq(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[(((3 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0)]].signalStart + 0],&circuitConstants[1]); // line circom 94
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 94. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+#ifndef TRUSTED_INPUTS
+Fr_eq(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[(((3 * lvar_2) + (1 * lvar_3)) + 0)]].signalStart + 0],&circuitConstants[1]); // line circom 94
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,94);
 assert(Fr_isTrue(&expaux[0]));
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[0]); // line circom 91
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[7]); // line circom 91
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-Fr_add(&expaux[0],&lvar[2],&circuitConstants[0]); // line circom 90
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[7]); // line circom 90
+#endif
+lvar_3 = lvar_3 + 1; // line circom 91
 }
-for (uint i = 0; i < 9; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_2 = lvar_2 + 1; // line circom 90
 }
 }
 
-void Requrie2DontOverlap_18_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void Requrie2DontOverlap_18_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 18;
 ctx->componentMemory[coffset].templateName = "Requrie2DontOverlap";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2209,13 +1815,24 @@ ctx->componentMemory[coffset].inputCounter = 7;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[12]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+7;
+static const uint aux_dimensions[2] = {3,4};
+for (uint i = 0; i < 12; i++) {
+Circom_ComponentName new_cmp_name = {"Eqs", aux_dimensions, 2, i};
+IsEqual_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 6 ;
+aux_cmp_num += 2;
+}
+}
 }
 
 void Requrie2DontOverlap_18_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -2223,57 +1840,22 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[3];
-FrElement lvar[4];
+uint lvar_0, lvar_1, lvar_2, lvar_3;
 uint sub_component_aux;
 uint index_multiple_eq;
+lvar_0 = 3;
+lvar_1 = 4;
+lvar_2 = 0;
+while(lvar_2 < 3){
+lvar_3 = 0;
+while(lvar_3 < 4){
 {
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[7]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[8]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+7;
-uint aux_dimensions[2] = {3,4};
-for (uint i = 0; i < 12; i++) {
-std::string new_cmp_name = "Eqs"+ctx->generate_position_array(aux_dimensions, 2, i);
-IsEqual_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 6 ;
-aux_cmp_num += 2;
-}
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[7]); // line circom 90
-while(Fr_isTrue(&expaux[0])){
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[8]); // line circom 91
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = (((4 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0);
+uint cmp_index_ref = (((4 * lvar_2) + (1 * lvar_3)) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[2])) + 0)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_2) + 0)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2282,12 +1864,12 @@ IsEqual_13_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = (((4 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0);
+uint cmp_index_ref = (((4 * lvar_2) + (1 * lvar_3)) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 3)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_3) + 3)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2295,34 +1877,18 @@ IsEqual_13_run(mySubcomponents[cmp_index_ref],ctx);
 
 }
 }
-Fr_eq(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[(((4 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0)]].signalStart + 0],&circuitConstants[1]); // line circom 94
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 94. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+#ifndef TRUSTED_INPUTS
+Fr_eq(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[(((4 * lvar_2) + (1 * lvar_3)) + 0)]].signalStart + 0],&circuitConstants[1]); // line circom 94
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,94);
 assert(Fr_isTrue(&expaux[0]));
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[0]); // line circom 91
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
+#endif
+lvar_3 = lvar_3 + 1; // line circom 91
 }
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[8]); // line circom 91
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-Fr_add(&expaux[0],&lvar[2],&circuitConstants[0]); // line circom 90
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[7]); // line circom 90
-}
-for (uint i = 0; i < 12; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_2 = lvar_2 + 1; // line circom 90
 }
 }
 
-void Requrie2DontOverlap_19_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void Requrie2DontOverlap_19_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 19;
 ctx->componentMemory[coffset].templateName = "Requrie2DontOverlap";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2330,13 +1896,24 @@ ctx->componentMemory[coffset].inputCounter = 8;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[15]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+8;
+static const uint aux_dimensions[2] = {3,5};
+for (uint i = 0; i < 15; i++) {
+Circom_ComponentName new_cmp_name = {"Eqs", aux_dimensions, 2, i};
+IsEqual_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 6 ;
+aux_cmp_num += 2;
+}
+}
 }
 
 void Requrie2DontOverlap_19_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -2344,57 +1921,22 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[3];
-FrElement lvar[4];
+uint lvar_0, lvar_1, lvar_2, lvar_3;
 uint sub_component_aux;
 uint index_multiple_eq;
+lvar_0 = 3;
+lvar_1 = 5;
+lvar_2 = 0;
+while(lvar_2 < 3){
+lvar_3 = 0;
+while(lvar_3 < 5){
 {
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[7]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[3]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+8;
-uint aux_dimensions[2] = {3,5};
-for (uint i = 0; i < 15; i++) {
-std::string new_cmp_name = "Eqs"+ctx->generate_position_array(aux_dimensions, 2, i);
-IsEqual_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 6 ;
-aux_cmp_num += 2;
-}
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[7]); // line circom 90
-while(Fr_isTrue(&expaux[0])){
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 91
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = (((5 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0);
+uint cmp_index_ref = (((5 * lvar_2) + (1 * lvar_3)) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[2])) + 0)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_2) + 0)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2403,12 +1945,12 @@ IsEqual_13_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = (((5 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0);
+uint cmp_index_ref = (((5 * lvar_2) + (1 * lvar_3)) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 3)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_3) + 3)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2416,34 +1958,18 @@ IsEqual_13_run(mySubcomponents[cmp_index_ref],ctx);
 
 }
 }
-Fr_eq(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[(((5 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0)]].signalStart + 0],&circuitConstants[1]); // line circom 94
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 94. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+#ifndef TRUSTED_INPUTS
+Fr_eq(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[(((5 * lvar_2) + (1 * lvar_3)) + 0)]].signalStart + 0],&circuitConstants[1]); // line circom 94
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,94);
 assert(Fr_isTrue(&expaux[0]));
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[0]); // line circom 91
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 91
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-Fr_add(&expaux[0],&lvar[2],&circuitConstants[0]); // line circom 90
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[7]); // line circom 90
+#endif
+lvar_3 = lvar_3 + 1; // line circom 91
 }
-for (uint i = 0; i < 15; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_2 = lvar_2 + 1; // line circom 90
 }
 }
 
-void Requrie2DontOverlap_20_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void Requrie2DontOverlap_20_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 20;
 ctx->componentMemory[coffset].templateName = "Requrie2DontOverlap";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2451,13 +1977,24 @@ ctx->componentMemory[coffset].inputCounter = 9;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[20]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+9;
+static const uint aux_dimensions[2] = {4,5};
+for (uint i = 0; i < 20; i++) {
+Circom_ComponentName new_cmp_name = {"Eqs", aux_dimensions, 2, i};
+IsEqual_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 6 ;
+aux_cmp_num += 2;
+}
+}
 }
 
 void Requrie2DontOverlap_20_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -2465,57 +2002,22 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[3];
-FrElement lvar[4];
+uint lvar_0, lvar_1, lvar_2, lvar_3;
 uint sub_component_aux;
 uint index_multiple_eq;
+lvar_0 = 4;
+lvar_1 = 5;
+lvar_2 = 0;
+while(lvar_2 < 4){
+lvar_3 = 0;
+while(lvar_3 < 5){
 {
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[8]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[3]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+9;
-uint aux_dimensions[2] = {4,5};
-for (uint i = 0; i < 20; i++) {
-std::string new_cmp_name = "Eqs"+ctx->generate_position_array(aux_dimensions, 2, i);
-IsEqual_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 6 ;
-aux_cmp_num += 2;
-}
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[8]); // line circom 90
-while(Fr_isTrue(&expaux[0])){
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 91
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = (((5 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0);
+uint cmp_index_ref = (((5 * lvar_2) + (1 * lvar_3)) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[2])) + 0)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_2) + 0)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2524,12 +2026,12 @@ IsEqual_13_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = (((5 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0);
+uint cmp_index_ref = (((5 * lvar_2) + (1 * lvar_3)) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 4)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_3) + 4)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2537,34 +2039,18 @@ IsEqual_13_run(mySubcomponents[cmp_index_ref],ctx);
 
 }
 }
-Fr_eq(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[(((5 * Fr_toInt(&lvar[2])) + (1 * Fr_toInt(&lvar[3]))) + 0)]].signalStart + 0],&circuitConstants[1]); // line circom 94
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 94. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+#ifndef TRUSTED_INPUTS
+Fr_eq(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[(((5 * lvar_2) + (1 * lvar_3)) + 0)]].signalStart + 0],&circuitConstants[1]); // line circom 94
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,94);
 assert(Fr_isTrue(&expaux[0]));
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[0]); // line circom 91
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 91
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-Fr_add(&expaux[0],&lvar[2],&circuitConstants[0]); // line circom 90
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
+#endif
+lvar_3 = lvar_3 + 1; // line circom 91
 }
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[8]); // line circom 90
-}
-for (uint i = 0; i < 20; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_2 = lvar_2 + 1; // line circom 90
 }
 }
 
-void PlaceFleet_21_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void PlaceFleet_21_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 21;
 ctx->componentMemory[coffset].templateName = "PlaceFleet";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2572,203 +2058,201 @@ ctx->componentMemory[coffset].inputCounter = 15;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[15]{0};
-}
-
-void PlaceFleet_21_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[2];
-FrElement lvar[0];
-uint sub_component_aux;
-uint index_multiple_eq;
 {
 uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+32;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+32;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "PlaceShip_101_3321";
-PlaceShip_8_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"PlaceShip_101_3321", NULL, 0, 0};
+PlaceShip_8_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 167 ;
 aux_cmp_num += 44;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 44+ctx_index+1;
-uint csoffset = mySignalStart+199;
+int aux_cmp_num = 44+coffset+1;
+uint csoffset = soffset+199;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "PlaceShip_102_3364";
-PlaceShip_9_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"PlaceShip_102_3364", NULL, 0, 0};
+PlaceShip_9_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 247 ;
 aux_cmp_num += 65;
 }
 }
 {
 uint aux_create = 2;
-int aux_cmp_num = 109+ctx_index+1;
-uint csoffset = mySignalStart+446;
+int aux_cmp_num = 109+coffset+1;
+uint csoffset = soffset+446;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "PlaceShip_103_3410";
-PlaceShip_9_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"PlaceShip_103_3410", NULL, 0, 0};
+PlaceShip_9_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 247 ;
 aux_cmp_num += 65;
 }
 }
 {
 uint aux_create = 3;
-int aux_cmp_num = 174+ctx_index+1;
-uint csoffset = mySignalStart+693;
+int aux_cmp_num = 174+coffset+1;
+uint csoffset = soffset+693;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "PlaceShip_104_3457";
-PlaceShip_10_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"PlaceShip_104_3457", NULL, 0, 0};
+PlaceShip_10_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 327 ;
 aux_cmp_num += 86;
 }
 }
 {
 uint aux_create = 4;
-int aux_cmp_num = 260+ctx_index+1;
-uint csoffset = mySignalStart+1020;
+int aux_cmp_num = 260+coffset+1;
+uint csoffset = soffset+1020;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "PlaceShip_105_3502";
-PlaceShip_11_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"PlaceShip_105_3502", NULL, 0, 0};
+PlaceShip_11_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 407 ;
 aux_cmp_num += 107;
 }
 }
 {
 uint aux_create = 5;
-int aux_cmp_num = 367+ctx_index+1;
-uint csoffset = mySignalStart+1427;
+int aux_cmp_num = 367+coffset+1;
+uint csoffset = soffset+1427;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "Requrie2DontOverlap_108_3601";
-Requrie2DontOverlap_14_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"Requrie2DontOverlap_108_3601", NULL, 0, 0};
+Requrie2DontOverlap_14_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 41 ;
 aux_cmp_num += 13;
 }
 }
 {
 uint aux_create = 6;
-int aux_cmp_num = 380+ctx_index+1;
-uint csoffset = mySignalStart+1468;
+int aux_cmp_num = 380+coffset+1;
+uint csoffset = soffset+1468;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "Requrie2DontOverlap_109_3656";
-Requrie2DontOverlap_14_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"Requrie2DontOverlap_109_3656", NULL, 0, 0};
+Requrie2DontOverlap_14_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 41 ;
 aux_cmp_num += 13;
 }
 }
 {
 uint aux_create = 7;
-int aux_cmp_num = 393+ctx_index+1;
-uint csoffset = mySignalStart+1509;
+int aux_cmp_num = 393+coffset+1;
+uint csoffset = soffset+1509;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "Requrie2DontOverlap_110_3711";
-Requrie2DontOverlap_15_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"Requrie2DontOverlap_110_3711", NULL, 0, 0};
+Requrie2DontOverlap_15_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 54 ;
 aux_cmp_num += 17;
 }
 }
 {
 uint aux_create = 8;
-int aux_cmp_num = 410+ctx_index+1;
-uint csoffset = mySignalStart+1563;
+int aux_cmp_num = 410+coffset+1;
+uint csoffset = soffset+1563;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "Requrie2DontOverlap_111_3767";
-Requrie2DontOverlap_16_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"Requrie2DontOverlap_111_3767", NULL, 0, 0};
+Requrie2DontOverlap_16_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 67 ;
 aux_cmp_num += 21;
 }
 }
 {
 uint aux_create = 9;
-int aux_cmp_num = 431+ctx_index+1;
-uint csoffset = mySignalStart+1630;
+int aux_cmp_num = 431+coffset+1;
+uint csoffset = soffset+1630;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "Requrie2DontOverlap_114_3889";
-Requrie2DontOverlap_17_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"Requrie2DontOverlap_114_3889", NULL, 0, 0};
+Requrie2DontOverlap_17_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 60 ;
 aux_cmp_num += 19;
 }
 }
 {
 uint aux_create = 10;
-int aux_cmp_num = 450+ctx_index+1;
-uint csoffset = mySignalStart+1690;
+int aux_cmp_num = 450+coffset+1;
+uint csoffset = soffset+1690;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "Requrie2DontOverlap_115_3947";
-Requrie2DontOverlap_18_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"Requrie2DontOverlap_115_3947", NULL, 0, 0};
+Requrie2DontOverlap_18_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 79 ;
 aux_cmp_num += 25;
 }
 }
 {
 uint aux_create = 11;
-int aux_cmp_num = 475+ctx_index+1;
-uint csoffset = mySignalStart+1769;
+int aux_cmp_num = 475+coffset+1;
+uint csoffset = soffset+1769;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "Requrie2DontOverlap_116_4006";
-Requrie2DontOverlap_19_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"Requrie2DontOverlap_116_4006", NULL, 0, 0};
+Requrie2DontOverlap_19_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 98 ;
 aux_cmp_num += 31;
 }
 }
 {
 uint aux_create = 12;
-int aux_cmp_num = 506+ctx_index+1;
-uint csoffset = mySignalStart+1867;
+int aux_cmp_num = 506+coffset+1;
+uint csoffset = soffset+1867;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "Requrie2DontOverlap_119_4131";
-Requrie2DontOverlap_18_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"Requrie2DontOverlap_119_4131", NULL, 0, 0};
+Requrie2DontOverlap_18_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 79 ;
 aux_cmp_num += 25;
 }
 }
 {
 uint aux_create = 13;
-int aux_cmp_num = 531+ctx_index+1;
-uint csoffset = mySignalStart+1946;
+int aux_cmp_num = 531+coffset+1;
+uint csoffset = soffset+1946;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "Requrie2DontOverlap_120_4190";
-Requrie2DontOverlap_19_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"Requrie2DontOverlap_120_4190", NULL, 0, 0};
+Requrie2DontOverlap_19_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 98 ;
 aux_cmp_num += 31;
 }
 }
 {
 uint aux_create = 14;
-int aux_cmp_num = 562+ctx_index+1;
-uint csoffset = mySignalStart+2044;
+int aux_cmp_num = 562+coffset+1;
+uint csoffset = soffset+2044;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "Requrie2DontOverlap_123_4316";
-Requrie2DontOverlap_20_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"Requrie2DontOverlap_123_4316", NULL, 0, 0};
+Requrie2DontOverlap_20_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 129 ;
 aux_cmp_num += 41;
 }
 }
+}
+
+void PlaceFleet_21_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[2];
+FrElement lvar[0];
+uint sub_component_aux;
+uint index_multiple_eq;
 {
 uint cmp_index_ref = 0;
 {
@@ -3089,13 +2573,9 @@ Fr_copyn(aux_dest,&signalValues[mySignalStart + 12],5);
 assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 5));
 Requrie2DontOverlap_20_run(mySubcomponents[cmp_index_ref],ctx);
 }
-for (uint i = 0; i < 15; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void FlattenFleet_22_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void FlattenFleet_22_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 22;
 ctx->componentMemory[coffset].templateName = "FlattenFleet";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -3108,8 +2588,6 @@ ctx->componentMemory[coffset].subcomponents = new uint[0];
 void FlattenFleet_22_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -3222,13 +2700,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 16];
 // end load src
 Fr_copy(aux_dest,&signalValues[mySignalStart + 33]);
 }
-for (uint i = 0; i < 0; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void MiMCFeistel_23_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void MiMCFeistel_23_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 23;
 ctx->componentMemory[coffset].templateName = "MiMCFeistel";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -3241,8 +2715,6 @@ ctx->componentMemory[coffset].subcomponents = new uint[0];
 void MiMCFeistel_23_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -3250,1364 +2722,42 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[6];
+static const uint lvar_1_constants[218] = {19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,35,37,39,41,43,45,47,49,51,53,55,57,59,61,63,65,66,68,70,72,74,76,78,80,82,84,86,88,90,92,94,96,98,100,102,104,106,108,110,112,114,116,118,120,122,124,126,128,130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,256,258,260,262,264,266,268,270,272,274,276,278,280,282,284,286,288,290,292,294,296,298,300,302,304,306,308,310,312,314,316,318,320,322,324,326,328,330,332,334,336,338,340,342,344,346,348,350,352,354,356,358,360,362,364,366,368,370,372,374,376,378,380,382,384,386,388,390,392,394,396,398,400,402,404,406,408,410,412,414,416,418,420,422,424,426,428,430,432,434,436};
 FrElement lvar[223];
+uint lvar_0, lvar_221;
 uint sub_component_aux;
 uint index_multiple_eq;
+lvar_0 = 220;
 {
-PFrElement aux_dest = &lvar[0];
+PFrElement aux_dest = &lvar[219];
 // load src
 // end load src
-Fr_copy(aux_dest,&circuitConstants[18]);
+Fr_copy(aux_dest,&circuitConstants[1]);
 }
 {
-PFrElement aux_dest = &lvar[1];
+PFrElement aux_dest = &lvar[220];
 // load src
 // end load src
-Fr_copy(aux_dest,&circuitConstants[19]);
+Fr_copy(aux_dest,&circuitConstants[1]);
 }
+lvar_221 = 0;
+while(lvar_221 < 220){
+if((lvar_221 == 0) || (lvar_221 == 219)){
 {
-PFrElement aux_dest = &lvar[2];
+PFrElement aux_dest = &lvar[220];
 // load src
 // end load src
-Fr_copy(aux_dest,&circuitConstants[20]);
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[21]);
-}
-{
-PFrElement aux_dest = &lvar[4];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[22]);
-}
-{
-PFrElement aux_dest = &lvar[5];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[23]);
-}
-{
-PFrElement aux_dest = &lvar[6];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[24]);
-}
-{
-PFrElement aux_dest = &lvar[7];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[25]);
-}
-{
-PFrElement aux_dest = &lvar[8];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[26]);
-}
-{
-PFrElement aux_dest = &lvar[9];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[27]);
-}
-{
-PFrElement aux_dest = &lvar[10];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[28]);
-}
-{
-PFrElement aux_dest = &lvar[11];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[29]);
-}
-{
-PFrElement aux_dest = &lvar[12];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[30]);
-}
-{
-PFrElement aux_dest = &lvar[13];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[31]);
-}
-{
-PFrElement aux_dest = &lvar[14];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[32]);
-}
-{
-PFrElement aux_dest = &lvar[15];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[33]);
-}
-{
-PFrElement aux_dest = &lvar[16];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[34]);
-}
-{
-PFrElement aux_dest = &lvar[17];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[35]);
-}
-{
-PFrElement aux_dest = &lvar[18];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[37]);
-}
-{
-PFrElement aux_dest = &lvar[19];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[39]);
-}
-{
-PFrElement aux_dest = &lvar[20];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[41]);
-}
-{
-PFrElement aux_dest = &lvar[21];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[43]);
-}
-{
-PFrElement aux_dest = &lvar[22];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[45]);
-}
-{
-PFrElement aux_dest = &lvar[23];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[47]);
-}
-{
-PFrElement aux_dest = &lvar[24];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[49]);
-}
-{
-PFrElement aux_dest = &lvar[25];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[51]);
-}
-{
-PFrElement aux_dest = &lvar[26];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[53]);
-}
-{
-PFrElement aux_dest = &lvar[27];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[55]);
-}
-{
-PFrElement aux_dest = &lvar[28];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[57]);
-}
-{
-PFrElement aux_dest = &lvar[29];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[59]);
-}
-{
-PFrElement aux_dest = &lvar[30];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[61]);
-}
-{
-PFrElement aux_dest = &lvar[31];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[63]);
-}
-{
-PFrElement aux_dest = &lvar[32];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[65]);
-}
-{
-PFrElement aux_dest = &lvar[33];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[66]);
-}
-{
-PFrElement aux_dest = &lvar[34];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[68]);
-}
-{
-PFrElement aux_dest = &lvar[35];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[70]);
-}
-{
-PFrElement aux_dest = &lvar[36];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[72]);
-}
-{
-PFrElement aux_dest = &lvar[37];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[74]);
-}
-{
-PFrElement aux_dest = &lvar[38];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[76]);
-}
-{
-PFrElement aux_dest = &lvar[39];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[78]);
-}
-{
-PFrElement aux_dest = &lvar[40];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[80]);
-}
-{
-PFrElement aux_dest = &lvar[41];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[82]);
-}
-{
-PFrElement aux_dest = &lvar[42];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[84]);
-}
-{
-PFrElement aux_dest = &lvar[43];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[86]);
-}
-{
-PFrElement aux_dest = &lvar[44];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[88]);
-}
-{
-PFrElement aux_dest = &lvar[45];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[90]);
-}
-{
-PFrElement aux_dest = &lvar[46];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[92]);
-}
-{
-PFrElement aux_dest = &lvar[47];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[94]);
-}
-{
-PFrElement aux_dest = &lvar[48];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[96]);
-}
-{
-PFrElement aux_dest = &lvar[49];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[98]);
-}
-{
-PFrElement aux_dest = &lvar[50];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[100]);
-}
-{
-PFrElement aux_dest = &lvar[51];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[102]);
-}
-{
-PFrElement aux_dest = &lvar[52];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[104]);
-}
-{
-PFrElement aux_dest = &lvar[53];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[106]);
-}
-{
-PFrElement aux_dest = &lvar[54];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[108]);
-}
-{
-PFrElement aux_dest = &lvar[55];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[110]);
-}
-{
-PFrElement aux_dest = &lvar[56];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[112]);
-}
-{
-PFrElement aux_dest = &lvar[57];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[114]);
-}
-{
-PFrElement aux_dest = &lvar[58];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[116]);
-}
-{
-PFrElement aux_dest = &lvar[59];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[118]);
-}
-{
-PFrElement aux_dest = &lvar[60];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[120]);
-}
-{
-PFrElement aux_dest = &lvar[61];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[122]);
-}
-{
-PFrElement aux_dest = &lvar[62];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[124]);
-}
-{
-PFrElement aux_dest = &lvar[63];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[126]);
-}
-{
-PFrElement aux_dest = &lvar[64];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[128]);
-}
-{
-PFrElement aux_dest = &lvar[65];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[130]);
-}
-{
-PFrElement aux_dest = &lvar[66];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[132]);
-}
-{
-PFrElement aux_dest = &lvar[67];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[134]);
-}
-{
-PFrElement aux_dest = &lvar[68];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[136]);
-}
-{
-PFrElement aux_dest = &lvar[69];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[138]);
-}
-{
-PFrElement aux_dest = &lvar[70];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[140]);
-}
-{
-PFrElement aux_dest = &lvar[71];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[142]);
-}
-{
-PFrElement aux_dest = &lvar[72];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[144]);
-}
-{
-PFrElement aux_dest = &lvar[73];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[146]);
-}
-{
-PFrElement aux_dest = &lvar[74];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[148]);
-}
-{
-PFrElement aux_dest = &lvar[75];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[150]);
-}
-{
-PFrElement aux_dest = &lvar[76];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[152]);
-}
-{
-PFrElement aux_dest = &lvar[77];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[154]);
-}
-{
-PFrElement aux_dest = &lvar[78];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[156]);
-}
-{
-PFrElement aux_dest = &lvar[79];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[158]);
-}
-{
-PFrElement aux_dest = &lvar[80];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[160]);
-}
-{
-PFrElement aux_dest = &lvar[81];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[162]);
-}
-{
-PFrElement aux_dest = &lvar[82];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[164]);
-}
-{
-PFrElement aux_dest = &lvar[83];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[166]);
-}
-{
-PFrElement aux_dest = &lvar[84];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[168]);
-}
-{
-PFrElement aux_dest = &lvar[85];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[170]);
-}
-{
-PFrElement aux_dest = &lvar[86];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[172]);
-}
-{
-PFrElement aux_dest = &lvar[87];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[174]);
-}
-{
-PFrElement aux_dest = &lvar[88];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[176]);
-}
-{
-PFrElement aux_dest = &lvar[89];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[178]);
-}
-{
-PFrElement aux_dest = &lvar[90];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[180]);
-}
-{
-PFrElement aux_dest = &lvar[91];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[182]);
-}
-{
-PFrElement aux_dest = &lvar[92];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[184]);
-}
-{
-PFrElement aux_dest = &lvar[93];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[186]);
-}
-{
-PFrElement aux_dest = &lvar[94];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[188]);
-}
-{
-PFrElement aux_dest = &lvar[95];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[190]);
-}
-{
-PFrElement aux_dest = &lvar[96];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[192]);
-}
-{
-PFrElement aux_dest = &lvar[97];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[194]);
-}
-{
-PFrElement aux_dest = &lvar[98];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[196]);
-}
-{
-PFrElement aux_dest = &lvar[99];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[198]);
-}
-{
-PFrElement aux_dest = &lvar[100];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[200]);
-}
-{
-PFrElement aux_dest = &lvar[101];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[202]);
-}
-{
-PFrElement aux_dest = &lvar[102];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[204]);
-}
-{
-PFrElement aux_dest = &lvar[103];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[206]);
-}
-{
-PFrElement aux_dest = &lvar[104];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[208]);
-}
-{
-PFrElement aux_dest = &lvar[105];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[210]);
-}
-{
-PFrElement aux_dest = &lvar[106];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[212]);
-}
-{
-PFrElement aux_dest = &lvar[107];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[214]);
-}
-{
-PFrElement aux_dest = &lvar[108];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[216]);
-}
-{
-PFrElement aux_dest = &lvar[109];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[218]);
-}
-{
-PFrElement aux_dest = &lvar[110];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[220]);
-}
-{
-PFrElement aux_dest = &lvar[111];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[222]);
-}
-{
-PFrElement aux_dest = &lvar[112];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[224]);
-}
-{
-PFrElement aux_dest = &lvar[113];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[226]);
-}
-{
-PFrElement aux_dest = &lvar[114];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[228]);
-}
-{
-PFrElement aux_dest = &lvar[115];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[230]);
-}
-{
-PFrElement aux_dest = &lvar[116];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[232]);
-}
-{
-PFrElement aux_dest = &lvar[117];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[234]);
-}
-{
-PFrElement aux_dest = &lvar[118];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[236]);
-}
-{
-PFrElement aux_dest = &lvar[119];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[238]);
-}
-{
-PFrElement aux_dest = &lvar[120];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[240]);
-}
-{
-PFrElement aux_dest = &lvar[121];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[242]);
-}
-{
-PFrElement aux_dest = &lvar[122];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[244]);
-}
-{
-PFrElement aux_dest = &lvar[123];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[246]);
-}
-{
-PFrElement aux_dest = &lvar[124];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[248]);
-}
-{
-PFrElement aux_dest = &lvar[125];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[250]);
-}
-{
-PFrElement aux_dest = &lvar[126];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[252]);
-}
-{
-PFrElement aux_dest = &lvar[127];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[254]);
-}
-{
-PFrElement aux_dest = &lvar[128];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[256]);
-}
-{
-PFrElement aux_dest = &lvar[129];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[258]);
-}
-{
-PFrElement aux_dest = &lvar[130];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[260]);
-}
-{
-PFrElement aux_dest = &lvar[131];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[262]);
-}
-{
-PFrElement aux_dest = &lvar[132];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[264]);
-}
-{
-PFrElement aux_dest = &lvar[133];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[266]);
-}
-{
-PFrElement aux_dest = &lvar[134];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[268]);
-}
-{
-PFrElement aux_dest = &lvar[135];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[270]);
-}
-{
-PFrElement aux_dest = &lvar[136];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[272]);
-}
-{
-PFrElement aux_dest = &lvar[137];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[274]);
-}
-{
-PFrElement aux_dest = &lvar[138];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[276]);
-}
-{
-PFrElement aux_dest = &lvar[139];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[278]);
-}
-{
-PFrElement aux_dest = &lvar[140];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[280]);
-}
-{
-PFrElement aux_dest = &lvar[141];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[282]);
-}
-{
-PFrElement aux_dest = &lvar[142];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[284]);
-}
-{
-PFrElement aux_dest = &lvar[143];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[286]);
-}
-{
-PFrElement aux_dest = &lvar[144];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[288]);
-}
-{
-PFrElement aux_dest = &lvar[145];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[290]);
-}
-{
-PFrElement aux_dest = &lvar[146];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[292]);
-}
-{
-PFrElement aux_dest = &lvar[147];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[294]);
-}
-{
-PFrElement aux_dest = &lvar[148];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[296]);
-}
-{
-PFrElement aux_dest = &lvar[149];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[298]);
-}
-{
-PFrElement aux_dest = &lvar[150];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[300]);
-}
-{
-PFrElement aux_dest = &lvar[151];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[302]);
-}
-{
-PFrElement aux_dest = &lvar[152];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[304]);
-}
-{
-PFrElement aux_dest = &lvar[153];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[306]);
-}
-{
-PFrElement aux_dest = &lvar[154];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[308]);
-}
-{
-PFrElement aux_dest = &lvar[155];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[310]);
-}
-{
-PFrElement aux_dest = &lvar[156];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[312]);
-}
-{
-PFrElement aux_dest = &lvar[157];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[314]);
-}
-{
-PFrElement aux_dest = &lvar[158];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[316]);
-}
-{
-PFrElement aux_dest = &lvar[159];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[318]);
-}
-{
-PFrElement aux_dest = &lvar[160];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[320]);
-}
-{
-PFrElement aux_dest = &lvar[161];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[322]);
-}
-{
-PFrElement aux_dest = &lvar[162];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[324]);
-}
-{
-PFrElement aux_dest = &lvar[163];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[326]);
-}
-{
-PFrElement aux_dest = &lvar[164];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[328]);
-}
-{
-PFrElement aux_dest = &lvar[165];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[330]);
-}
-{
-PFrElement aux_dest = &lvar[166];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[332]);
-}
-{
-PFrElement aux_dest = &lvar[167];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[334]);
-}
-{
-PFrElement aux_dest = &lvar[168];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[336]);
-}
-{
-PFrElement aux_dest = &lvar[169];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[338]);
-}
-{
-PFrElement aux_dest = &lvar[170];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[340]);
-}
-{
-PFrElement aux_dest = &lvar[171];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[342]);
-}
-{
-PFrElement aux_dest = &lvar[172];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[344]);
-}
-{
-PFrElement aux_dest = &lvar[173];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[346]);
-}
-{
-PFrElement aux_dest = &lvar[174];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[348]);
-}
-{
-PFrElement aux_dest = &lvar[175];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[350]);
-}
-{
-PFrElement aux_dest = &lvar[176];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[352]);
-}
-{
-PFrElement aux_dest = &lvar[177];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[354]);
-}
-{
-PFrElement aux_dest = &lvar[178];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[356]);
-}
-{
-PFrElement aux_dest = &lvar[179];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[358]);
-}
-{
-PFrElement aux_dest = &lvar[180];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[360]);
-}
-{
-PFrElement aux_dest = &lvar[181];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[362]);
-}
-{
-PFrElement aux_dest = &lvar[182];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[364]);
-}
-{
-PFrElement aux_dest = &lvar[183];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[366]);
-}
-{
-PFrElement aux_dest = &lvar[184];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[368]);
-}
-{
-PFrElement aux_dest = &lvar[185];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[370]);
-}
-{
-PFrElement aux_dest = &lvar[186];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[372]);
-}
-{
-PFrElement aux_dest = &lvar[187];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[374]);
-}
-{
-PFrElement aux_dest = &lvar[188];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[376]);
-}
-{
-PFrElement aux_dest = &lvar[189];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[378]);
-}
-{
-PFrElement aux_dest = &lvar[190];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[380]);
-}
-{
-PFrElement aux_dest = &lvar[191];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[382]);
-}
-{
-PFrElement aux_dest = &lvar[192];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[384]);
-}
-{
-PFrElement aux_dest = &lvar[193];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[386]);
-}
-{
-PFrElement aux_dest = &lvar[194];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[388]);
-}
-{
-PFrElement aux_dest = &lvar[195];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[390]);
-}
-{
-PFrElement aux_dest = &lvar[196];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[392]);
-}
-{
-PFrElement aux_dest = &lvar[197];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[394]);
-}
-{
-PFrElement aux_dest = &lvar[198];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[396]);
-}
-{
-PFrElement aux_dest = &lvar[199];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[398]);
-}
-{
-PFrElement aux_dest = &lvar[200];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[400]);
-}
-{
-PFrElement aux_dest = &lvar[201];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[402]);
-}
-{
-PFrElement aux_dest = &lvar[202];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[404]);
-}
-{
-PFrElement aux_dest = &lvar[203];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[406]);
-}
-{
-PFrElement aux_dest = &lvar[204];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[408]);
-}
-{
-PFrElement aux_dest = &lvar[205];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[410]);
-}
-{
-PFrElement aux_dest = &lvar[206];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[412]);
-}
-{
-PFrElement aux_dest = &lvar[207];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[414]);
-}
-{
-PFrElement aux_dest = &lvar[208];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[416]);
-}
-{
-PFrElement aux_dest = &lvar[209];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[418]);
-}
-{
-PFrElement aux_dest = &lvar[210];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[420]);
-}
-{
-PFrElement aux_dest = &lvar[211];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[422]);
-}
-{
-PFrElement aux_dest = &lvar[212];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[424]);
-}
-{
-PFrElement aux_dest = &lvar[213];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[426]);
-}
-{
-PFrElement aux_dest = &lvar[214];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[428]);
-}
-{
-PFrElement aux_dest = &lvar[215];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[430]);
-}
-{
-PFrElement aux_dest = &lvar[216];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[432]);
-}
-{
-PFrElement aux_dest = &lvar[217];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[434]);
-}
-{
-PFrElement aux_dest = &lvar[218];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[436]);
-}
-{
-PFrElement aux_dest = &lvar[219];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-{
-PFrElement aux_dest = &lvar[220];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-{
-PFrElement aux_dest = &lvar[221];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[221],&circuitConstants[18]); // line circom 275
-while(Fr_isTrue(&expaux[0])){
-Fr_eq(&expaux[1],&lvar[221],&circuitConstants[1]); // line circom 276
-Fr_eq(&expaux[2],&lvar[221],&circuitConstants[437]); // line circom 276
-Fr_lor(&expaux[0],&expaux[1],&expaux[2]); // line circom 276
-if(Fr_isTrue(&expaux[0])){
-{
-PFrElement aux_dest = &lvar[220];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
+Fr_copy(aux_dest,&circuitConstants[1]);
 }
 }else{
 {
 PFrElement aux_dest = &lvar[220];
 // load src
-Fr_sub(&expaux[0],&lvar[221],&circuitConstants[0]); // line circom 279
 // end load src
-Fr_copy(aux_dest,&lvar[((1 * Fr_toInt(&expaux[0])) + 1)]);
+Fr_copy(aux_dest,&circuitConstants[lvar_1_constants[(1 * (lvar_221 - 1))]]);
 }
 }
-Fr_eq(&expaux[0],&lvar[221],&circuitConstants[1]); // line circom 281
-if(Fr_isTrue(&expaux[0])){
+if(lvar_221 == 0){
 {
 PFrElement aux_dest = &lvar[219];
 // load src
@@ -4619,31 +2769,28 @@ Fr_copy(aux_dest,&expaux[0]);
 {
 PFrElement aux_dest = &lvar[219];
 // load src
-Fr_sub(&expaux[3],&lvar[221],&circuitConstants[0]); // line circom 281
-Fr_add(&expaux[1],&signalValues[mySignalStart + 4],&signalValues[mySignalStart + ((1 * Fr_toInt(&expaux[3])) + 445)]); // line circom 281
+Fr_add(&expaux[1],&signalValues[mySignalStart + 4],&signalValues[mySignalStart + ((1 * (lvar_221 - 1)) + 445)]); // line circom 281
 Fr_add(&expaux[0],&expaux[1],&lvar[220]); // line circom 281
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 5)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_221) + 5)];
 // load src
 Fr_mul(&expaux[0],&lvar[219],&lvar[219]); // line circom 282
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 225)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_221) + 225)];
 // load src
-Fr_mul(&expaux[0],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 5)],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 5)]); // line circom 283
+Fr_mul(&expaux[0],&signalValues[mySignalStart + ((1 * lvar_221) + 5)],&signalValues[mySignalStart + ((1 * lvar_221) + 5)]); // line circom 283
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
-Fr_lt(&expaux[0],&lvar[221],&circuitConstants[437]); // line circom 284
-if(Fr_isTrue(&expaux[0])){
-Fr_eq(&expaux[0],&lvar[221],&circuitConstants[1]); // line circom 285
-if(Fr_isTrue(&expaux[0])){
+if(lvar_221 < 219){
+if(lvar_221 == 0){
 {
 PFrElement aux_dest = &lvar[222];
 // load src
@@ -4654,139 +2801,97 @@ Fr_copy(aux_dest,&signalValues[mySignalStart + 3]);
 {
 PFrElement aux_dest = &lvar[222];
 // load src
-Fr_sub(&expaux[0],&lvar[221],&circuitConstants[0]); // line circom 285
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&expaux[0])) + 664)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * (lvar_221 - 1)) + 664)]);
 }
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 445)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_221) + 445)];
 // load src
-Fr_mul(&expaux[2],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 225)],&lvar[219]); // line circom 286
+Fr_mul(&expaux[2],&signalValues[mySignalStart + ((1 * lvar_221) + 225)],&lvar[219]); // line circom 286
 Fr_add(&expaux[0],&lvar[222],&expaux[2]); // line circom 286
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
-Fr_eq(&expaux[0],&lvar[221],&circuitConstants[1]); // line circom 287
-if(Fr_isTrue(&expaux[0])){
+if(lvar_221 == 0){
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 664)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_221) + 664)];
 // load src
 // end load src
 Fr_copy(aux_dest,&signalValues[mySignalStart + 2]);
 }
 }else{
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 664)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_221) + 664)];
 // load src
-Fr_sub(&expaux[0],&lvar[221],&circuitConstants[0]); // line circom 287
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&expaux[0])) + 445)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * (lvar_221 - 1)) + 445)]);
 }
 }
 }else{
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 1];
 // load src
-Fr_mul(&expaux[2],&signalValues[mySignalStart + 444],&lvar[219]); // line circom 289
-Fr_add(&expaux[0],&signalValues[mySignalStart + 882],&expaux[2]); // line circom 289
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-{
-PFrElement aux_dest = &signalValues[mySignalStart + 0];
-// load src
-// end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + 663]);
-}
-}
-{
-PFrElement aux_dest = &lvar[221];
-// load src
-Fr_add(&expaux[0],&lvar[221],&circuitConstants[0]); // line circom 275
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[221],&circuitConstants[18]); // line circom 275
-}
-for (uint i = 0; i < 0; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
-}
-
-void MiMCSponge_24_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
-ctx->componentMemory[coffset].templateId = 24;
-ctx->componentMemory[coffset].templateName = "MiMCSponge";
-ctx->componentMemory[coffset].signalStart = soffset;
-ctx->componentMemory[coffset].inputCounter = 18;
-ctx->componentMemory[coffset].componentName = componentName;
-ctx->componentMemory[coffset].idFather = componentFather;
-ctx->componentMemory[coffset].subcomponents = new uint[17]{0};
-}
-
-void MiMCSponge_24_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[5];
-FrElement lvar[4];
-uint sub_component_aux;
-uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[36]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
+Fr_mul(&expaux[2],&signalValues[mySignalStart + 444],&lvar[219]); // line circom 289
+Fr_add(&expaux[0],&signalValues[mySignalStart + 882],&expaux[2]); // line circom 289
 // end load src
-Fr_copy(aux_dest,&circuitConstants[0]);
+Fr_copy(aux_dest,&expaux[0]);
 }
 {
-PFrElement aux_dest = &lvar[2];
+PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // load src
 // end load src
-Fr_copy(aux_dest,&circuitConstants[18]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + 663]);
+}
+}
+lvar_221 = lvar_221 + 1; // line circom 275
 }
+}
+
+void MiMCSponge_24_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
+ctx->componentMemory[coffset].templateId = 24;
+ctx->componentMemory[coffset].templateName = "MiMCSponge";
+ctx->componentMemory[coffset].signalStart = soffset;
+ctx->componentMemory[coffset].inputCounter = 18;
+ctx->componentMemory[coffset].componentName = componentName;
+ctx->componentMemory[coffset].idFather = componentFather;
+ctx->componentMemory[coffset].subcomponents = new uint[17]{0};
 {
 uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+19;
-uint aux_dimensions[1] = {17};
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+19;
+static const uint aux_dimensions[1] = {17};
 for (uint i = 0; i < 17; i++) {
-std::string new_cmp_name = "S"+ctx->generate_position_array(aux_dimensions, 1, i);
-MiMCFeistel_23_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"S", aux_dimensions, 1, i};
+MiMCFeistel_23_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 883 ;
 aux_cmp_num += 1;
 }
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
 }
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[36]); // line circom 16
-while(Fr_isTrue(&expaux[0])){
+
+void MiMCSponge_24_generated_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[5];
+uint lvar_0, lvar_1, lvar_2, lvar_3;
+uint sub_component_aux;
+uint index_multiple_eq;
+lvar_0 = 17;
+lvar_1 = 1;
+lvar_2 = 220;
+lvar_3 = 0;
+lvar_3 = 0;
+while(lvar_3 < 17){
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[3])) + 0);
+uint cmp_index_ref = ((1 * lvar_3) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 4];
 // load src
@@ -4799,8 +2904,7 @@ MiMCFeistel_23_run(mySubcomponents[cmp_index_ref],ctx);
 
 }
 }
-Fr_eq(&expaux[0],&lvar[3],&circuitConstants[1]); // line circom 19
-if(Fr_isTrue(&expaux[0])){
+if(lvar_3 == 0){
 {
 uint cmp_index_ref = 0;
 {
@@ -4831,12 +2935,11 @@ MiMCFeistel_23_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }else{
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[3])) + 0);
+uint cmp_index_ref = ((1 * lvar_3) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
-Fr_sub(&expaux[1],&lvar[3],&circuitConstants[0]); // line circom 23
-Fr_add(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * Fr_toInt(&expaux[1])) + 0)]].signalStart + 0],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 1)]); // line circom 23
+Fr_add(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * (lvar_3 - 1)) + 0)]].signalStart + 0],&signalValues[mySignalStart + ((1 * lvar_3) + 1)]); // line circom 23
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
@@ -4847,13 +2950,12 @@ MiMCFeistel_23_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[3])) + 0);
+uint cmp_index_ref = ((1 * lvar_3) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 3];
 // load src
-Fr_sub(&expaux[0],&lvar[3],&circuitConstants[0]); // line circom 24
 // end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * Fr_toInt(&expaux[0])) + 0)]].signalStart + 1]);
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * (lvar_3 - 1)) + 0)]].signalStart + 1]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -4862,14 +2964,7 @@ MiMCFeistel_23_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[0]); // line circom 16
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[36]); // line circom 16
+lvar_3 = lvar_3 + 1; // line circom 16
 }
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 0];
@@ -4877,19 +2972,20 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[16]].signalStart + 0]);
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-for (uint i = 0; i < 17; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_3 = 0;
 }
+
+// MiMCSponge(17, 220, 1) runs natively, see mimc.hpp
+void MiMCSponge_24_run(uint ctx_index,Circom_CalcWit* ctx){
+#ifdef MIMC_VERIFY
+MiMCSponge_24_generated_run(ctx_index,ctx);
+MiMCSponge_verify(ctx,ctx_index,17,1);
+#else
+MiMCSponge_native(&ctx->signalValues[ctx->componentMemory[ctx_index].signalStart],17,1);
+#endif
 }
 
-void HashFleet_25_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void HashFleet_25_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 25;
 ctx->componentMemory[coffset].templateName = "HashFleet";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -4897,13 +2993,23 @@ ctx->componentMemory[coffset].inputCounter = 18;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[1]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+20;
+for (uint i = 0; i < 1; i++) {
+Circom_ComponentName new_cmp_name = {"MiMCSponge_31_825", NULL, 0, 0};
+MiMCSponge_24_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 15030 ;
+aux_cmp_num += 18;
+}
+}
 }
 
 void HashFleet_25_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -4915,18 +3021,6 @@ FrElement lvar[0];
 uint sub_component_aux;
 uint index_multiple_eq;
 {
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+20;
-for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "MiMCSponge_31_825";
-MiMCSponge_24_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 15030 ;
-aux_cmp_num += 18;
-}
-}
-{
 uint cmp_index_ref = 0;
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
@@ -4961,13 +3055,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&signalValues[mySignalStart + 19]);
 }
-for (uint i = 0; i < 1; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void MiMCSponge_26_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void MiMCSponge_26_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 26;
 ctx->componentMemory[coffset].templateName = "MiMCSponge";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -4975,13 +3065,24 @@ ctx->componentMemory[coffset].inputCounter = 3;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[2]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+4;
+static const uint aux_dimensions[1] = {2};
+for (uint i = 0; i < 2; i++) {
+Circom_ComponentName new_cmp_name = {"S", aux_dimensions, 1, i};
+MiMCFeistel_23_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 883 ;
+aux_cmp_num += 1;
+}
+}
 }
 
-void MiMCSponge_26_run(uint ctx_index,Circom_CalcWit* ctx){
+void MiMCSponge_26_generated_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -4989,56 +3090,17 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[3];
-FrElement lvar[4];
+uint lvar_0, lvar_1, lvar_2, lvar_3;
 uint sub_component_aux;
 uint index_multiple_eq;
+lvar_0 = 2;
+lvar_1 = 1;
+lvar_2 = 220;
+lvar_3 = 0;
+lvar_3 = 0;
+while(lvar_3 < 2){
 {
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[6]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[0]);
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[18]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+4;
-uint aux_dimensions[1] = {2};
-for (uint i = 0; i < 2; i++) {
-std::string new_cmp_name = "S"+ctx->generate_position_array(aux_dimensions, 1, i);
-MiMCFeistel_23_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 883 ;
-aux_cmp_num += 1;
-}
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[6]); // line circom 16
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[3])) + 0);
+uint cmp_index_ref = ((1 * lvar_3) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 4];
 // load src
@@ -5051,8 +3113,7 @@ MiMCFeistel_23_run(mySubcomponents[cmp_index_ref],ctx);
 
 }
 }
-Fr_eq(&expaux[0],&lvar[3],&circuitConstants[1]); // line circom 19
-if(Fr_isTrue(&expaux[0])){
+if(lvar_3 == 0){
 {
 uint cmp_index_ref = 0;
 {
@@ -5112,14 +3173,7 @@ MiMCFeistel_23_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[0]); // line circom 16
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[6]); // line circom 16
+lvar_3 = lvar_3 + 1; // line circom 16
 }
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 0];
@@ -5127,19 +3181,20 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[1]].signalStart + 0]);
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-for (uint i = 0; i < 2; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_3 = 0;
 }
+
+// MiMCSponge(2, 220, 1) runs natively, see mimc.hpp
+void MiMCSponge_26_run(uint ctx_index,Circom_CalcWit* ctx){
+#ifdef MIMC_VERIFY
+MiMCSponge_26_generated_run(ctx_index,ctx);
+MiMCSponge_verify(ctx,ctx_index,2,1);
+#else
+MiMCSponge_native(&ctx->signalValues[ctx->componentMemory[ctx_index].signalStart],2,1);
+#endif
 }
 
-void HashState_27_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void HashState_27_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 27;
 ctx->componentMemory[coffset].templateName = "HashState";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -5147,69 +3202,57 @@ ctx->componentMemory[coffset].inputCounter = 35;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[18]{0};
-}
-
-void HashState_27_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[3];
-FrElement lvar[2];
-uint sub_component_aux;
-uint index_multiple_eq;
 {
 uint aux_create = 0;
-int aux_cmp_num = 51+ctx_index+1;
-uint csoffset = mySignalStart+30161;
+int aux_cmp_num = 51+coffset+1;
+uint csoffset = soffset+30161;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "MiMCSponge_61_1908";
-MiMCSponge_24_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"MiMCSponge_61_1908", NULL, 0, 0};
+MiMCSponge_24_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 15030 ;
 aux_cmp_num += 18;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+71;
-uint aux_dimensions[1] = {17};
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+71;
+static const uint aux_dimensions[1] = {17};
 for (uint i = 0; i < 17; i++) {
-std::string new_cmp_name = "MiMCSponge_56_1713"+ctx->generate_position_array(aux_dimensions, 1, i);
-MiMCSponge_26_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"MiMCSponge_56_1713", aux_dimensions, 1, i};
+MiMCSponge_26_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 1770 ;
 aux_cmp_num += 3;
 }
 }
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
 }
-Fr_lt(&expaux[0],&lvar[1],&circuitConstants[36]); // line circom 55
-while(Fr_isTrue(&expaux[0])){
+
+void HashState_27_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[3];
+uint lvar_0, lvar_1;
+uint sub_component_aux;
+uint index_multiple_eq;
+#ifdef MIMC_VERIFY
+lvar_0 = 0;
+lvar_1 = 0;
+while(lvar_1 < 17){
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[0])) + 1);
+uint cmp_index_ref = ((1 * lvar_0) + 1);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[1])) + 1)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_1) + 1)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -5218,12 +3261,12 @@ MiMCSponge_26_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[0])) + 1);
+uint cmp_index_ref = ((1 * lvar_0) + 1);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[1])) + 18)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_1) + 18)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -5232,7 +3275,7 @@ MiMCSponge_26_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[0])) + 1);
+uint cmp_index_ref = ((1 * lvar_0) + 1);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 3];
 // load src
@@ -5246,33 +3289,45 @@ MiMCSponge_26_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[1])) + 36)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_1) + 36)];
 // load src
 // end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * Fr_toInt(&lvar[0])) + 1)]].signalStart + 0]);
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * lvar_0) + 1)]].signalStart + 0]);
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[1])) + 53)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_1) + 53)];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + (((1 * Fr_toInt(&lvar[1])) + 0) + 36)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + (((1 * lvar_1) + 0) + 36)]);
 }
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-Fr_add(&expaux[0],&lvar[1],&circuitConstants[0]); // line circom 55
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
+lvar_1 = lvar_1 + 1; // line circom 55
+lvar_0 = lvar_0 + 1; // line circom 55
 }
+MiMCSponge_verify_lanes(ctx,&mySubcomponents[1],17,2,1);
+#else
+// the 17 leaf sponges MiMCSponge(2, 220, 1) are independent: they run in lockstep,
+// one group of lanes per free thread
 {
-PFrElement aux_dest = &lvar[0];
-// load src
-Fr_add(&expaux[0],&lvar[0],&circuitConstants[0]); // line circom 55
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
+PFrElement leaves[17];
+for (uint i = 0; i < 17; i++) {
+uint cmp_index_ref = i + 1;
+leaves[i] = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart];
+Fr_copy(&leaves[i][1],&signalValues[mySignalStart + i + 1]);
+Fr_copy(&leaves[i][2],&signalValues[mySignalStart + i + 18]);
+Fr_copy(&leaves[i][3],&signalValues[mySignalStart + 35]);
+ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 3;
+}
+uint width = MiMCSponge_lanesWidth();
+ctx->parallelFor((17 + width - 1) / width, [&](uint j) {
+uint first = j * width;
+MiMCSponge_native_lanes(&leaves[first],17 - first < width ? 17 - first : width,2,1);
+});
+for (uint i = 0; i < 17; i++) {
+Fr_copy(&signalValues[mySignalStart + i + 36],&leaves[i][0]);
+Fr_copy(&signalValues[mySignalStart + i + 53],&signalValues[mySignalStart + i + 36]);
 }
-Fr_lt(&expaux[0],&lvar[1],&circuitConstants[36]); // line circom 55
 }
+#endif
 {
 uint cmp_index_ref = 0;
 {
@@ -5308,13 +3363,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&signalValues[mySignalStart + 70]);
 }
-for (uint i = 0; i < 18; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void InitState_28_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void InitState_28_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 28;
 ctx->componentMemory[coffset].templateName = "InitState";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -5322,83 +3373,108 @@ ctx->componentMemory[coffset].inputCounter = 33;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[5]{0};
-}
-
-void InitState_28_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[3];
-FrElement lvar[1];
-uint sub_component_aux;
-uint index_multiple_eq;
+ctx->componentMemory[coffset].subcomponentsParallel = new bool[5]{false};
+ctx->componentMemory[coffset].sbct = new std::thread[5];
 {
 uint aux_create = 0;
-int aux_cmp_num = 109+ctx_index+1;
-uint csoffset = mySignalStart+75412;
+int aux_cmp_num = 109+coffset+1;
+uint csoffset = soffset+75412;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "PlaceFleet_86_3143";
-PlaceFleet_21_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"PlaceFleet_86_3143", NULL, 0, 0};
+PlaceFleet_21_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 2173 ;
 aux_cmp_num += 604;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+87;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+87;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "FlattenFleet_89_3289";
-FlattenFleet_22_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"FlattenFleet_89_3289", NULL, 0, 0};
+FlattenFleet_22_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 34 ;
 aux_cmp_num += 1;
 }
 }
 {
 uint aux_create = 2;
-int aux_cmp_num = 20+ctx_index+1;
-uint csoffset = mySignalStart+15171;
+int aux_cmp_num = 20+coffset+1;
+uint csoffset = soffset+15171;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "HashFleet_90_3385";
-HashFleet_25_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"HashFleet_90_3385", NULL, 0, 0};
+HashFleet_25_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+ctx->componentMemory[coffset].subcomponentsParallel[aux_create+i] = true;
 csoffset += 15050 ;
 aux_cmp_num += 19;
 }
 }
 {
 uint aux_create = 3;
-int aux_cmp_num = 39+ctx_index+1;
-uint csoffset = mySignalStart+30221;
+int aux_cmp_num = 39+coffset+1;
+uint csoffset = soffset+30221;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "HashState_97_3596";
-HashState_27_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"HashState_97_3596", NULL, 0, 0};
+HashState_27_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 45191 ;
 aux_cmp_num += 70;
 }
 }
 {
 uint aux_create = 4;
-int aux_cmp_num = 1+ctx_index+1;
-uint csoffset = mySignalStart+121;
+int aux_cmp_num = 1+coffset+1;
+uint csoffset = soffset+121;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "HashFleet_100_3694";
-HashFleet_25_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"HashFleet_100_3694", NULL, 0, 0};
+HashFleet_25_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+ctx->componentMemory[coffset].subcomponentsParallel[aux_create+i] = true;
 csoffset += 15050 ;
 aux_cmp_num += 19;
 }
 }
+}
+
+void InitState_28_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[3];
+uint lvar_0;
+uint sub_component_aux;
+uint index_multiple_eq;
+{
+uint cmp_index_ref = 4;
+{
+PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
+// load src
+// end load src
+Fr_copyn(aux_dest,&signalValues[mySignalStart + 18],17);
+}
+// no need to run sub component
+assert(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 17);
+}
+{
+uint cmp_index_ref = 4;
+{
+PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 18];
+// load src
+// end load src
+Fr_copy(aux_dest,&signalValues[mySignalStart + 35]);
+}
+// need to run sub component
+assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1));
+ctx->runParallel(HashFleet_25_run,mySubcomponents[cmp_index_ref],ctx->componentMemory[ctx_index].sbct[cmp_index_ref]);
+}
 {
 uint cmp_index_ref = 0;
 {
@@ -5568,36 +3644,17 @@ Fr_copy(aux_dest,&signalValues[mySignalStart + 35]);
 }
 // need to run sub component
 assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1));
-HashFleet_25_run(mySubcomponents[cmp_index_ref],ctx);
-}
-{
-PFrElement aux_dest = &signalValues[mySignalStart + 0];
-// load src
-// end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[2]].signalStart + 0]);
-}
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
+ctx->runParallel(HashFleet_25_run,mySubcomponents[cmp_index_ref],ctx->componentMemory[ctx_index].sbct[cmp_index_ref]);
 }
-Fr_lt(&expaux[0],&lvar[0],&circuitConstants[36]); // line circom 94
-while(Fr_isTrue(&expaux[0])){
+lvar_0 = 0;
+while(lvar_0 < 17){
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[0])) + 70)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_0) + 70)];
 // load src
 // end load src
 Fr_copy(aux_dest,&circuitConstants[1]);
 }
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-Fr_add(&expaux[0],&lvar[0],&circuitConstants[0]); // line circom 94
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[0],&circuitConstants[36]); // line circom 94
+lvar_0 = lvar_0 + 1; // line circom 94
 }
 {
 uint cmp_index_ref = 3;
@@ -5633,49 +3690,35 @@ Fr_copy(aux_dest,&signalValues[mySignalStart + 35]);
 assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1));
 HashState_27_run(mySubcomponents[cmp_index_ref],ctx);
 }
+// wait for the parallel sub component
+ctx->joinParallel(ctx->componentMemory[ctx_index].sbct[2]);
 {
-PFrElement aux_dest = &signalValues[mySignalStart + 1];
-// load src
-// end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[3]].signalStart + 0]);
-}
-{
-uint cmp_index_ref = 4;
-{
-PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
+PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // load src
 // end load src
-Fr_copyn(aux_dest,&signalValues[mySignalStart + 18],17);
-}
-// no need to run sub component
-assert(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 17);
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[2]].signalStart + 0]);
 }
 {
-uint cmp_index_ref = 4;
-{
-PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 18];
+PFrElement aux_dest = &signalValues[mySignalStart + 1];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + 35]);
-}
-// need to run sub component
-assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1));
-HashFleet_25_run(mySubcomponents[cmp_index_ref],ctx);
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[3]].signalStart + 0]);
 }
+// wait for the parallel sub component
+ctx->joinParallel(ctx->componentMemory[ctx_index].sbct[4]);
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 2];
 // load src
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[4]].signalStart + 0]);
 }
-for (uint i = 0; i < 5; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
 }
+
+void create_components(Circom_CalcWit* ctx){
+InitState_28_create(1,0,ctx,{"main", NULL, 0, 0},0);
 }
 
 void run(Circom_CalcWit* ctx){
-InitState_28_create(1,0,ctx,"main",0);
 InitState_28_run(0,ctx);
 }
 
@@ -0,0 +1,497 @@
+#include <stdio.h>
+#include <iostream>
+#include <assert.h>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "circom.hpp"
+#include "calcwit.hpp"
+#include "mimc.hpp"
+#include "tape.hpp"
+
+#ifndef TAPE_CIRCUIT
+#error "TAPE_CIRCUIT must name the generated source of the circuit"
+#endif
+
+#define TAPE_BINARY_OPS(X) X(add) X(sub) X(mul) X(div) X(idiv) X(mod) X(pow) \
+  X(eq) X(neq) X(lt) X(gt) X(leq) X(geq) X(land) X(lor) X(band) X(bor) X(bxor) X(shl) X(shr)
+#define TAPE_UNARY_OPS(X) X(neg) X(square) X(inv) X(lnot) X(bnot)
+
+#define TAPE_OPCODE(name) TapeOp_##name,
+enum TapeOpCode : u32 {
+  TapeOp_copy,
+  TapeOp_setShort,   // r = the short element a
+  TapeOp_check,      // the truth of a must be b, or the witness goes to the generated code
+  TapeOp_inverse,    // r = 1/a, deferred to the batch inversion after the run
+  TapeOp_mimc,       // MiMCSponge_native at signal r, a inputs, b outputs
+  TapeOp_mimcLanes,  // MiMCSponge_native_lanes of the a signals listed at lanes[r], b = nInputs<<16 | nOutputs
+  TAPE_BINARY_OPS(TAPE_OPCODE)
+  TAPE_UNARY_OPS(TAPE_OPCODE)
+};
+
+struct TapeOp {
+  u32 code;
+  u32 r;
+  u32 a;
+  u32 b;
+};
+
+// An operand is a signal, a constant or a temporary: the kind in the top
+// two bits, then its index
+#define TAPE_SIGNAL 0
+#define TAPE_CONSTANT 1
+#define TAPE_TEMP 2
+#define TAPE_KIND_SHIFT 30
+#define TAPE_INDEX_MASK 0x3FFFFFFF
+
+struct WitnessTape {
+  std::vector<TapeOp> ops;
+  std::vector<u32> lanes;
+  u32 nTemps = 0;
+};
+
+/*
+Recording: the generated code is compiled a second time below, with its
+field operations redirected to wrappers that compute them as usual and
+append them to the tape. Pointers into the signals and the constants
+become their indexes. Any other pointer is a local of a *_run (expaux,
+lvar) and becomes a temporary, one per address, which keeps the flow of
+values between them since the recorded run is sequential.
+*/
+struct TapeRecorder {
+  WitnessTape *tape;
+  PFrElement signals;
+  PFrElement constants;
+  u64 nSignals;
+  u64 nConstants;
+  std::unordered_map<PFrElement, u32> temps;
+  bool failed;
+
+  u32 operand(PFrElement p) {
+    if (p >= signals && p < signals + nSignals) {
+      return (TAPE_SIGNAL << TAPE_KIND_SHIFT) | (u32)(p - signals);
+    }
+    if (p >= constants && p < constants + nConstants) {
+      return (TAPE_CONSTANT << TAPE_KIND_SHIFT) | (u32)(p - constants);
+    }
+    auto it = temps.emplace(p, tape->nTemps);
+    if (it.second) tape->nTemps++;
+    return (TAPE_TEMP << TAPE_KIND_SHIFT) | it.first->second;
+  }
+
+  void op(u32 code, PFrElement r, PFrElement a, PFrElement b) {
+    tape->ops.push_back({code, operand(r), operand(a), b ? operand(b) : 0});
+  }
+
+  bool isSignal(u32 x) {
+    return (x >> TAPE_KIND_SHIFT) == TAPE_SIGNAL;
+  }
+};
+
+static TapeRecorder *recorder;
+
+#define TAPE_RECORD_BINARY(name) \
+static void TapeRecord_##name(PFrElement r, PFrElement a, PFrElement b) { \
+  recorder->op(TapeOp_##name, r, a, b); \
+  Fr_##name(r, a, b); \
+}
+#define TAPE_RECORD_UNARY(name) \
+static void TapeRecord_##name(PFrElement r, PFrElement a) { \
+  recorder->op(TapeOp_##name, r, a, NULL); \
+  Fr_##name(r, a); \
+}
+TAPE_BINARY_OPS(TAPE_RECORD_BINARY)
+TAPE_UNARY_OPS(TAPE_RECORD_UNARY)
+
+static void TapeRecord_copy(PFrElement r, PFrElement a) {
+  recorder->op(TapeOp_copy, r, a, NULL);
+  Fr_copy(r, a);
+}
+
+static void TapeRecord_copyn(PFrElement r, PFrElement a, int n) {
+  for (int i = 0; i < n; i++) TapeRecord_copy(r + i, a + i);
+}
+
+static void TapeRecord_fromInt(PFrElement r, int a) {
+  recorder->tape->ops.push_back({TapeOp_setShort, recorder->operand(r), (u32)a, 0});
+  Fr_fromInt(r, a);
+}
+
+static int TapeRecord_isTrue(PFrElement a) {
+  int value = Fr_isTrue(a);
+  u32 x = recorder->operand(a);
+  if ((x >> TAPE_KIND_SHIFT) == TAPE_CONSTANT) return value;
+  std::vector<TapeOp> &ops = recorder->tape->ops;
+  // an assert tests its condition twice: once to report it, once in assert()
+  if (ops.empty() || ops.back().code != TapeOp_check || ops.back().a != x) {
+    ops.push_back({TapeOp_check, 0, x, (u32)value});
+  }
+  return value;
+}
+
+static int TapeRecord_toInt(PFrElement a) {
+  // an index computed from a value: the run cannot be linearised
+  recorder->failed = true;
+  return Fr_toInt(a);
+}
+
+static PFrElement TapeRecord_inverse(PFrElement r, PFrElement a) {
+  recorder->op(TapeOp_inverse, r, a, NULL);
+  return r;
+}
+
+static void TapeRecord_mimc(FrElement *signals, uint nInputs, uint nOutputs) {
+  u32 x = recorder->operand(signals);
+  if (!recorder->isSignal(x)) recorder->failed = true;
+  recorder->tape->ops.push_back({TapeOp_mimc, x, nInputs, nOutputs});
+  MiMCSponge_native(signals, nInputs, nOutputs);
+}
+
+static void TapeRecord_mimcLanes(PFrElement *signals, uint nLanes, uint nInputs, uint nOutputs) {
+  WitnessTape *tape = recorder->tape;
+  tape->ops.push_back({TapeOp_mimcLanes, (u32)tape->lanes.size(), nLanes, (nInputs << 16) | nOutputs});
+  for (uint i = 0; i < nLanes; i++) {
+    u32 x = recorder->operand(signals[i]);
+    if (!recorder->isSignal(x)) recorder->failed = true;
+    tape->lanes.push_back(x);
+  }
+  MiMCSponge_native_lanes(signals, nLanes, nInputs, nOutputs);
+}
+
+#define Fr_copy TapeRecord_copy
+#define Fr_copyn TapeRecord_copyn
+#define Fr_fromInt TapeRecord_fromInt
+#define Fr_isTrue TapeRecord_isTrue
+#define Fr_toInt TapeRecord_toInt
+#define Fr_add TapeRecord_add
+#define Fr_sub TapeRecord_sub
+#define Fr_mul TapeRecord_mul
+#define Fr_div TapeRecord_div
+#define Fr_idiv TapeRecord_idiv
+#define Fr_mod TapeRecord_mod
+#define Fr_pow TapeRecord_pow
+#define Fr_eq TapeRecord_eq
+#define Fr_neq TapeRecord_neq
+#define Fr_lt TapeRecord_lt
+#define Fr_gt TapeRecord_gt
+#define Fr_leq TapeRecord_leq
+#define Fr_geq TapeRecord_geq
+#define Fr_land TapeRecord_land
+#define Fr_lor TapeRecord_lor
+#define Fr_band TapeRecord_band
+#define Fr_bor TapeRecord_bor
+#define Fr_bxor TapeRecord_bxor
+#define Fr_shl TapeRecord_shl
+#define Fr_shr TapeRecord_shr
+#define Fr_neg TapeRecord_neg
+#define Fr_square TapeRecord_square
+#define Fr_inv TapeRecord_inv
+#define Fr_lnot TapeRecord_lnot
+#define Fr_bnot TapeRecord_bnot
+#define MiMCSponge_native TapeRecord_mimc
+#define MiMCSponge_native_lanes TapeRecord_mimcLanes
+#define deferInverse(r, a) deferInverse(TapeRecord_inverse(r, a), a)
+
+// the headers it includes are already in, so only its code lands here
+namespace tape_record {
+#include TAPE_CIRCUIT
+}
+
+#undef Fr_copy
+#undef Fr_copyn
+#undef Fr_fromInt
+#undef Fr_isTrue
+#undef Fr_toInt
+#undef Fr_add
+#undef Fr_sub
+#undef Fr_mul
+#undef Fr_div
+#undef Fr_idiv
+#undef Fr_mod
+#undef Fr_pow
+#undef Fr_eq
+#undef Fr_neq
+#undef Fr_lt
+#undef Fr_gt
+#undef Fr_leq
+#undef Fr_geq
+#undef Fr_land
+#undef Fr_lor
+#undef Fr_band
+#undef Fr_bor
+#undef Fr_bxor
+#undef Fr_shl
+#undef Fr_shr
+#undef Fr_neg
+#undef Fr_square
+#undef Fr_inv
+#undef Fr_lnot
+#undef Fr_bnot
+#undef MiMCSponge_native
+#undef MiMCSponge_native_lanes
+#undef deferInverse
+
+/*
+Slots: once recorded, the tape is compiled for a small working set. A
+signal out of the witness and of the sponges, which the tape writes before
+reading it, only carries a value from one op to the next ones, so it
+becomes a temporary as well. A backward pass finds the last read of every
+value held by a temporary: the ops whose result nothing reads are dropped,
+and the temporaries share slots, each one taken by a write and given back
+at the last read of its value. The signals written by the replay are then
+the witness and the sponges, and the slots stay in the first level cache.
+*/
+#define TAPE_CASE(name) case TapeOp_##name:
+
+// The operands read by op, in reads; returns their number
+static uint tapeReads(const TapeOp &op, u32 *reads) {
+  switch (op.code) {
+  TAPE_BINARY_OPS(TAPE_CASE)
+    reads[0] = op.a;
+    reads[1] = op.b;
+    return 2;
+  case TapeOp_copy:
+  case TapeOp_check:
+  case TapeOp_inverse:
+  TAPE_UNARY_OPS(TAPE_CASE)
+    reads[0] = op.a;
+    return 1;
+  default:
+    return 0;
+  }
+}
+
+// Whether op writes its result to the operand r while it is replayed
+static bool tapeWrites(const TapeOp &op) {
+  switch (op.code) {
+  case TapeOp_check:
+  case TapeOp_inverse:
+  case TapeOp_mimc:
+  case TapeOp_mimcLanes:
+    return false;
+  default:
+    return true;
+  }
+}
+
+#undef TAPE_CASE
+
+static inline bool tapeIs(u32 x, u32 kind) {
+  return (x >> TAPE_KIND_SHIFT) == kind;
+}
+
+static void allocateSlots(WitnessTape *tape, Circom_CalcWit *ctx) {
+  std::vector<TapeOp> &ops = tape->ops;
+  u32 reads[2];
+
+  // the signals that stay: the witness, the sponges, the destinations of
+  // the inverses and the signals read before the tape writes them
+  std::vector<bool> keep(ctx->nSignals, false);
+  std::vector<bool> written(ctx->nSignals, false);
+  uint nWitness = get_size_of_witness();
+  for (uint i = 0; i < nWitness; i++) keep[ctx->getWitnessSignal(i)] = true;
+  auto keepSponge = [&](u32 x, uint nInputs, uint nOutputs) {
+    uint n = MiMCSponge_size(nInputs, nOutputs);
+    for (uint i = 0; i < n; i++) keep[(x & TAPE_INDEX_MASK) + i] = true;
+  };
+  for (const TapeOp &op : ops) {
+    if (op.code == TapeOp_mimc) {
+      keepSponge(op.r, op.a, op.b);
+    } else if (op.code == TapeOp_mimcLanes) {
+      for (u32 i = 0; i < op.a; i++) keepSponge(tape->lanes[op.r + i], op.b >> 16, op.b & 0xFFFF);
+    } else if (op.code == TapeOp_inverse && tapeIs(op.r, TAPE_SIGNAL)) {
+      keep[op.r & TAPE_INDEX_MASK] = true;
+    }
+    uint n = tapeReads(op, reads);
+    for (uint i = 0; i < n; i++) {
+      if (tapeIs(reads[i], TAPE_SIGNAL) && !written[reads[i] & TAPE_INDEX_MASK]) {
+        keep[reads[i] & TAPE_INDEX_MASK] = true;
+      }
+    }
+    if (tapeWrites(op) && tapeIs(op.r, TAPE_SIGNAL)) written[op.r & TAPE_INDEX_MASK] = true;
+  }
+
+  // the other signals become temporaries
+  std::vector<u32> signalTemp(ctx->nSignals, UINT32_MAX);
+  auto rename = [&](u32 &x) {
+    u32 s = x & TAPE_INDEX_MASK;
+    if (!tapeIs(x, TAPE_SIGNAL) || keep[s]) return;
+    if (signalTemp[s] == UINT32_MAX) signalTemp[s] = tape->nTemps++;
+    x = (TAPE_TEMP << TAPE_KIND_SHIFT) | signalTemp[s];
+  };
+  for (TapeOp &op : ops) {
+    uint n = tapeReads(op, reads);
+    if (n > 0) rename(op.a);
+    if (n > 1) rename(op.b);
+    if (tapeWrites(op)) rename(op.r);
+  }
+
+  // liveness, backwards: dead writes and the last read of every value. A
+  // temporary an inverse is deferred to, or read before it is written (a
+  // local not set yet), keeps a slot of its own over the whole tape
+  std::vector<bool> pinned(tape->nTemps, false);
+  for (const TapeOp &op : ops) {
+    if (op.code == TapeOp_inverse && tapeIs(op.r, TAPE_TEMP)) pinned[op.r & TAPE_INDEX_MASK] = true;
+  }
+  std::vector<bool> live(tape->nTemps, false);
+  std::vector<bool> dead(ops.size(), false);
+  std::vector<u8> lastRead(ops.size(), 0);
+  for (size_t k = ops.size(); k-- > 0;) {
+    const TapeOp &op = ops[k];
+    if (tapeWrites(op) && tapeIs(op.r, TAPE_TEMP)) {
+      u32 t = op.r & TAPE_INDEX_MASK;
+      if (!live[t] && !pinned[t]) {
+        dead[k] = true;
+        continue;
+      }
+      live[t] = false;
+    }
+    uint n = tapeReads(op, reads);
+    for (uint i = 0; i < n; i++) {
+      if (!tapeIs(reads[i], TAPE_TEMP)) continue;
+      u32 t = reads[i] & TAPE_INDEX_MASK;
+      if (!live[t]) {
+        lastRead[k] |= 1 << i;
+        live[t] = true;
+      }
+    }
+  }
+  for (u32 t = 0; t < tape->nTemps; t++) {
+    if (live[t]) pinned[t] = true;
+  }
+
+  // slots, forwards: the reads of an op take their slots before its write
+  // takes one, so that no result overwrites an argument of its own op
+  std::vector<u32> slot(tape->nTemps, UINT32_MAX);
+  std::vector<u32> freeSlots;
+  u32 nSlots = 0;
+  for (u32 t = 0; t < tape->nTemps; t++) {
+    if (pinned[t]) slot[t] = nSlots++;
+  }
+  size_t nOps = 0;
+  for (size_t k = 0; k < ops.size(); k++) {
+    if (dead[k]) continue;
+    TapeOp op = ops[k];
+    uint n = tapeReads(op, reads);
+    u32 freed[2];
+    uint nFreed = 0;
+    for (uint i = 0; i < n; i++) {
+      if (!tapeIs(reads[i], TAPE_TEMP)) continue;
+      u32 t = reads[i] & TAPE_INDEX_MASK;
+      assert(slot[t] != UINT32_MAX);
+      reads[i] = (TAPE_TEMP << TAPE_KIND_SHIFT) | slot[t];
+      if ((lastRead[k] >> i) & 1 && !pinned[t]) freed[nFreed++] = slot[t];
+    }
+    if (n > 0) op.a = reads[0];
+    if (n > 1) op.b = reads[1];
+    if ((tapeWrites(op) || op.code == TapeOp_inverse) && tapeIs(op.r, TAPE_TEMP)) {
+      u32 t = op.r & TAPE_INDEX_MASK;
+      if (!pinned[t]) {
+        if (freeSlots.empty()) {
+          slot[t] = nSlots++;
+        } else {
+          slot[t] = freeSlots.back();
+          freeSlots.pop_back();
+        }
+      }
+      op.r = (TAPE_TEMP << TAPE_KIND_SHIFT) | slot[t];
+    }
+    for (uint i = 0; i < nFreed; i++) freeSlots.push_back(freed[i]);
+    ops[nOps++] = op;
+  }
+  ops.resize(nOps);
+  tape->nTemps = nSlots;
+}
+
+static std::mutex tapeMutex;
+static std::atomic<WitnessTape *> theTape(NULL);
+static std::atomic<bool> tapeFailed(false);
+
+// Computes the witness with the generated code while recording the tape
+static void recordTape(Circom_CalcWit *ctx) {
+  WitnessTape *tape = new WitnessTape;
+  TapeRecorder rec;
+  rec.tape = tape;
+  rec.signals = ctx->signalValues;
+  rec.constants = ctx->circuitConstants;
+  rec.nSignals = ctx->nSignals;
+  rec.nConstants = get_size_of_constants();
+  rec.failed = false;
+  // the recorder follows a single thread: no parallel subcomponents meanwhile
+  int maxThread = ctx->maxThread;
+  ctx->maxThread = 0;
+  recorder = &rec;
+  try {
+    tape_record::run(ctx);
+  } catch (...) {
+    // a failed check: the witness is reported, and the next one records
+    recorder = NULL;
+    ctx->maxThread = maxThread;
+    delete tape;
+    throw;
+  }
+  recorder = NULL;
+  ctx->maxThread = maxThread;
+  if (rec.failed) {
+    delete tape;
+    tapeFailed = true;
+    return;
+  }
+  allocateSlots(tape, ctx);
+  tape->ops.shrink_to_fit();
+  theTape = tape;
+}
+
+static bool replayTape(const WitnessTape &tape, Circom_CalcWit *ctx) {
+  thread_local std::vector<FrElement> temps;
+  thread_local std::vector<PFrElement> lanes;
+  temps.resize(tape.nTemps);
+  FrElement *base[3] = { ctx->signalValues, ctx->circuitConstants, temps.data() };
+#define TAPE_OPERAND(x) (&base[(x) >> TAPE_KIND_SHIFT][(x) & TAPE_INDEX_MASK])
+#define TAPE_REPLAY_BINARY(name) \
+    case TapeOp_##name: Fr_##name(TAPE_OPERAND(op->r), TAPE_OPERAND(op->a), TAPE_OPERAND(op->b)); break;
+#define TAPE_REPLAY_UNARY(name) \
+    case TapeOp_##name: Fr_##name(TAPE_OPERAND(op->r), TAPE_OPERAND(op->a)); break;
+  const TapeOp *end = tape.ops.data() + tape.ops.size();
+  for (const TapeOp *op = tape.ops.data(); op < end; op++) {
+    switch (op->code) {
+    case TapeOp_copy:
+      *TAPE_OPERAND(op->r) = *TAPE_OPERAND(op->a);
+      break;
+    case TapeOp_setShort:
+      Fr_fromInt(TAPE_OPERAND(op->r), (int)op->a);
+      break;
+    case TapeOp_check:
+      // a failed assert: the generated code computes the witness again and throws it
+      // (the inverses deferred so far are deferred again, which is harmless)
+      if (Fr_isTrue(TAPE_OPERAND(op->a)) != (int)op->b) return false;
+      break;
+    case TapeOp_inverse:
+      ctx->deferInverse(TAPE_OPERAND(op->r), TAPE_OPERAND(op->a));
+      break;
+    case TapeOp_mimc:
+      MiMCSponge_native(TAPE_OPERAND(op->r), op->a, op->b);
+      break;
+    case TapeOp_mimcLanes:
+      lanes.resize(op->a);
+      for (u32 i = 0; i < op->a; i++) lanes[i] = TAPE_OPERAND(tape.lanes[op->r + i]);
+      MiMCSponge_native_lanes(lanes.data(), op->a, op->b >> 16, op->b & 0xFFFF);
+      break;
+    TAPE_BINARY_OPS(TAPE_REPLAY_BINARY)
+    TAPE_UNARY_OPS(TAPE_REPLAY_UNARY)
+    }
+  }
+  return true;
+}
+
+bool WitnessTape_run(Circom_CalcWit *ctx) {
+  WitnessTape *tape = theTape;
+  if (tape != NULL) return replayTape(*tape, ctx);
+  if (tapeFailed) return false;
+  // one context records it, the others run the generated code meanwhile
+  std::unique_lock<std::mutex> lock(tapeMutex, std::try_to_lock);
+  if (!lock.owns_lock() || theTape != NULL || tapeFailed) return false;
+  recordTape(ctx);
+  return true;
+}
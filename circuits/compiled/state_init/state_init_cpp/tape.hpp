@@ -0,0 +1,21 @@
+#ifndef __TAPE_H
+#define __TAPE_H
+
+#include "calcwit.hpp"
+
+/*
+Witness tape: the field operations of a whole run of the circuit, as one
+flat list over signals, constants and temporaries. It is recorded once,
+from the first witness computed by the generated code, and then replayed
+by a single loop: no *_run calls, no setup of their locals and no input
+counters. The component tree is fixed and no branch of the generated code
+depends on the inputs, so the tape holds for every witness. Asserts are
+recorded as checks, and a witness that fails one is computed again by
+the generated code, which throws the failed check (see failedAssert()).
+*/
+
+// Computes the witness of ctx from the tape, recording it on first use.
+// Returns false when the generated code has to compute the witness.
+bool WitnessTape_run(Circom_CalcWit *ctx);
+
+#endif // __TAPE_H
@@ -7,6 +7,7 @@
 
 #define Fr_N64 4
 #define Fr_SHORT 0x00000000
+#define Fr_SHORTMONTGOMERY 0x40000000
 #define Fr_LONG 0x80000000
 #define Fr_LONGMONTGOMERY 0xC0000000
 typedef uint64_t FrRawElement[Fr_N64];
@@ -21,6 +22,11 @@ extern FrElement Fr_R3;
 extern FrRawElement Fr_rawq;
 extern FrRawElement Fr_rawR3;
 
+extern "C" void Fr_fail();
+
+#ifdef FR_GENERIC
+#include "fr_generic.hpp"
+#else
 extern "C" void Fr_copy(PFrElement r, PFrElement a);
 extern "C" void Fr_copyn(PFrElement r, PFrElement a, int n);
 extern "C" void Fr_add(PFrElement r, PFrElement a, PFrElement b);
@@ -62,8 +68,17 @@ extern "C" void Fr_rawToMontgomery(FrRawElement pRawResult, const FrRawElement &
 extern "C" void Fr_rawFromMontgomery(FrRawElement pRawResult, const FrRawElement &pRawA);
 extern "C" int Fr_rawIsEq(const FrRawElement pRawA, const FrRawElement pRawB);
 extern "C" int Fr_rawIsZero(const FrRawElement pRawB);
+#endif
 
-extern "C" void Fr_fail();
+
+// a^-1 in Montgomery form for a in Montgomery form (0 for 0), without GMP
+void Fr_rawInv(FrRawElement pRawResult, const FrRawElement pRawA);
+// the inverses of n elements (0 for 0) for the cost of one inversion,
+// results may alias the inputs
+void Fr_rawBatchInv(FrRawElement *pRawResult, const FrRawElement *pRawA, int n);
+
+// the short element of a native integer, for loop counters read as field values
+inline void Fr_fromInt(PFrElement r, int a) { r->shortVal = a; r->type = Fr_SHORT; }
 
 
 // Pending functions to convert
@@ -74,6 +89,7 @@ void Fr_idiv(PFrElement r, PFrElement a, PFrElement b);
 void Fr_mod(PFrElement r, PFrElement a, PFrElement b);
 void Fr_inv(PFrElement r, PFrElement a);
 void Fr_div(PFrElement r, PFrElement a, PFrElement b);
+void Fr_batchInv(PFrElement r, PFrElement a, int n);
 void Fr_pow(PFrElement r, PFrElement a, PFrElement b);
 
 class RawFr {
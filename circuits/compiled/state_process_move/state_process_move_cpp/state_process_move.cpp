@@ -3,41 +3,42 @@
 #include <assert.h>
 #include "circom.hpp"
 #include "calcwit.hpp"
-void MiMCFeistel_0_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+#include "mimc.hpp"
+void MiMCFeistel_0_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void MiMCFeistel_0_run(uint ctx_index,Circom_CalcWit* ctx);
-void MiMCSponge_1_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void MiMCSponge_1_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void MiMCSponge_1_run(uint ctx_index,Circom_CalcWit* ctx);
-void HashFleet_2_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void HashFleet_2_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void HashFleet_2_run(uint ctx_index,Circom_CalcWit* ctx);
-void MiMCSponge_3_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void MiMCSponge_3_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void MiMCSponge_3_run(uint ctx_index,Circom_CalcWit* ctx);
-void HashState_4_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void HashState_4_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void HashState_4_run(uint ctx_index,Circom_CalcWit* ctx);
-void IsZero_5_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void IsZero_5_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void IsZero_5_run(uint ctx_index,Circom_CalcWit* ctx);
-void IsEqual_6_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void IsEqual_6_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void IsEqual_6_run(uint ctx_index,Circom_CalcWit* ctx);
-void RequireBinary_7_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void RequireBinary_7_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void RequireBinary_7_run(uint ctx_index,Circom_CalcWit* ctx);
-void BinaryArrayCount_8_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void BinaryArrayCount_8_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void BinaryArrayCount_8_run(uint ctx_index,Circom_CalcWit* ctx);
-void ProcessMove_9_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void ProcessMove_9_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void ProcessMove_9_run(uint ctx_index,Circom_CalcWit* ctx);
-void AND_10_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void AND_10_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void AND_10_run(uint ctx_index,Circom_CalcWit* ctx);
-void MultiAND_11_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void MultiAND_11_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void MultiAND_11_run(uint ctx_index,Circom_CalcWit* ctx);
-void MultiAND_12_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void MultiAND_12_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void MultiAND_12_run(uint ctx_index,Circom_CalcWit* ctx);
-void MultiAND_13_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void MultiAND_13_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void MultiAND_13_run(uint ctx_index,Circom_CalcWit* ctx);
-void MultiAND_14_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void MultiAND_14_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void MultiAND_14_run(uint ctx_index,Circom_CalcWit* ctx);
-void MultiAND_15_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void MultiAND_15_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void MultiAND_15_run(uint ctx_index,Circom_CalcWit* ctx);
-void GetSunk_16_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void GetSunk_16_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void GetSunk_16_run(uint ctx_index,Circom_CalcWit* ctx);
-void UpdateState_17_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather);
+void UpdateState_17_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather);
 void UpdateState_17_run(uint ctx_index,Circom_CalcWit* ctx);
 Circom_TemplateFunction _functionTable[18] = { 
 MiMCFeistel_0_run,
@@ -61,1407 +62,94 @@ UpdateState_17_run };
 Circom_TemplateFunction _functionTableParallel[18] = { 
 NULL,
 NULL,
-NULL,
-NULL,
-NULL,
-NULL,
-NULL,
-NULL,
-NULL,
-NULL,
-NULL,
-NULL,
-NULL,
-NULL,
-NULL,
-NULL,
-NULL,
-NULL };
-uint get_main_input_signal_start() {return 8;}
-
-uint get_main_input_signal_no() {return 56;}
-
-uint get_total_signal_no() {return 120915;}
-
-uint get_number_of_components() {return 277;}
-
-uint get_size_of_input_hashmap() {return 256;}
-
-uint get_size_of_witness() {return 89860;}
-
-uint get_size_of_constants() {return 439;}
-
-uint get_size_of_io_map() {return 3;}
-
-void release_memory_component(Circom_CalcWit* ctx, uint pos) {{
-
-if (pos != 0){{
-
-if(ctx->componentMemory[pos].subcomponents)
-delete []ctx->componentMemory[pos].subcomponents;
-
-if(ctx->componentMemory[pos].subcomponentsParallel)
-delete []ctx->componentMemory[pos].subcomponentsParallel;
-
-if(ctx->componentMemory[pos].outputIsSet)
-delete []ctx->componentMemory[pos].outputIsSet;
-
-if(ctx->componentMemory[pos].mutexes)
-delete []ctx->componentMemory[pos].mutexes;
-
-if(ctx->componentMemory[pos].cvs)
-delete []ctx->componentMemory[pos].cvs;
-
-if(ctx->componentMemory[pos].sbct)
-delete []ctx->componentMemory[pos].sbct;
-
-}}
-
-
-}}
-
-
-// function declarations
-// template declarations
-void MiMCFeistel_0_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
-ctx->componentMemory[coffset].templateId = 0;
-ctx->componentMemory[coffset].templateName = "MiMCFeistel";
-ctx->componentMemory[coffset].signalStart = soffset;
-ctx->componentMemory[coffset].inputCounter = 3;
-ctx->componentMemory[coffset].componentName = componentName;
-ctx->componentMemory[coffset].idFather = componentFather;
-ctx->componentMemory[coffset].subcomponents = new uint[0];
-}
-
-void MiMCFeistel_0_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[6];
-FrElement lvar[223];
-uint sub_component_aux;
-uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[0]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[2]);
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[4]);
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[6]);
-}
-{
-PFrElement aux_dest = &lvar[4];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[8]);
-}
-{
-PFrElement aux_dest = &lvar[5];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[10]);
-}
-{
-PFrElement aux_dest = &lvar[6];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[12]);
-}
-{
-PFrElement aux_dest = &lvar[7];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[14]);
-}
-{
-PFrElement aux_dest = &lvar[8];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[16]);
-}
-{
-PFrElement aux_dest = &lvar[9];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[18]);
-}
-{
-PFrElement aux_dest = &lvar[10];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[20]);
-}
-{
-PFrElement aux_dest = &lvar[11];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[22]);
-}
-{
-PFrElement aux_dest = &lvar[12];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[24]);
-}
-{
-PFrElement aux_dest = &lvar[13];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[26]);
-}
-{
-PFrElement aux_dest = &lvar[14];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[28]);
-}
-{
-PFrElement aux_dest = &lvar[15];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[30]);
-}
-{
-PFrElement aux_dest = &lvar[16];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[32]);
-}
-{
-PFrElement aux_dest = &lvar[17];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[34]);
-}
-{
-PFrElement aux_dest = &lvar[18];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[36]);
-}
-{
-PFrElement aux_dest = &lvar[19];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[38]);
-}
-{
-PFrElement aux_dest = &lvar[20];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[40]);
-}
-{
-PFrElement aux_dest = &lvar[21];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[42]);
-}
-{
-PFrElement aux_dest = &lvar[22];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[44]);
-}
-{
-PFrElement aux_dest = &lvar[23];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[46]);
-}
-{
-PFrElement aux_dest = &lvar[24];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[48]);
-}
-{
-PFrElement aux_dest = &lvar[25];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[50]);
-}
-{
-PFrElement aux_dest = &lvar[26];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[52]);
-}
-{
-PFrElement aux_dest = &lvar[27];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[54]);
-}
-{
-PFrElement aux_dest = &lvar[28];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[56]);
-}
-{
-PFrElement aux_dest = &lvar[29];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[58]);
-}
-{
-PFrElement aux_dest = &lvar[30];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[60]);
-}
-{
-PFrElement aux_dest = &lvar[31];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[62]);
-}
-{
-PFrElement aux_dest = &lvar[32];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[64]);
-}
-{
-PFrElement aux_dest = &lvar[33];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[66]);
-}
-{
-PFrElement aux_dest = &lvar[34];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[68]);
-}
-{
-PFrElement aux_dest = &lvar[35];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[70]);
-}
-{
-PFrElement aux_dest = &lvar[36];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[72]);
-}
-{
-PFrElement aux_dest = &lvar[37];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[74]);
-}
-{
-PFrElement aux_dest = &lvar[38];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[76]);
-}
-{
-PFrElement aux_dest = &lvar[39];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[78]);
-}
-{
-PFrElement aux_dest = &lvar[40];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[80]);
-}
-{
-PFrElement aux_dest = &lvar[41];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[82]);
-}
-{
-PFrElement aux_dest = &lvar[42];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[84]);
-}
-{
-PFrElement aux_dest = &lvar[43];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[86]);
-}
-{
-PFrElement aux_dest = &lvar[44];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[88]);
-}
-{
-PFrElement aux_dest = &lvar[45];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[90]);
-}
-{
-PFrElement aux_dest = &lvar[46];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[92]);
-}
-{
-PFrElement aux_dest = &lvar[47];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[94]);
-}
-{
-PFrElement aux_dest = &lvar[48];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[96]);
-}
-{
-PFrElement aux_dest = &lvar[49];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[98]);
-}
-{
-PFrElement aux_dest = &lvar[50];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[100]);
-}
-{
-PFrElement aux_dest = &lvar[51];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[102]);
-}
-{
-PFrElement aux_dest = &lvar[52];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[104]);
-}
-{
-PFrElement aux_dest = &lvar[53];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[106]);
-}
-{
-PFrElement aux_dest = &lvar[54];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[108]);
-}
-{
-PFrElement aux_dest = &lvar[55];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[110]);
-}
-{
-PFrElement aux_dest = &lvar[56];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[112]);
-}
-{
-PFrElement aux_dest = &lvar[57];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[114]);
-}
-{
-PFrElement aux_dest = &lvar[58];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[116]);
-}
-{
-PFrElement aux_dest = &lvar[59];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[118]);
-}
-{
-PFrElement aux_dest = &lvar[60];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[120]);
-}
-{
-PFrElement aux_dest = &lvar[61];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[122]);
-}
-{
-PFrElement aux_dest = &lvar[62];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[124]);
-}
-{
-PFrElement aux_dest = &lvar[63];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[126]);
-}
-{
-PFrElement aux_dest = &lvar[64];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[128]);
-}
-{
-PFrElement aux_dest = &lvar[65];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[130]);
-}
-{
-PFrElement aux_dest = &lvar[66];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[132]);
-}
-{
-PFrElement aux_dest = &lvar[67];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[134]);
-}
-{
-PFrElement aux_dest = &lvar[68];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[136]);
-}
-{
-PFrElement aux_dest = &lvar[69];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[138]);
-}
-{
-PFrElement aux_dest = &lvar[70];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[140]);
-}
-{
-PFrElement aux_dest = &lvar[71];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[142]);
-}
-{
-PFrElement aux_dest = &lvar[72];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[144]);
-}
-{
-PFrElement aux_dest = &lvar[73];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[146]);
-}
-{
-PFrElement aux_dest = &lvar[74];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[148]);
-}
-{
-PFrElement aux_dest = &lvar[75];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[150]);
-}
-{
-PFrElement aux_dest = &lvar[76];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[152]);
-}
-{
-PFrElement aux_dest = &lvar[77];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[154]);
-}
-{
-PFrElement aux_dest = &lvar[78];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[156]);
-}
-{
-PFrElement aux_dest = &lvar[79];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[158]);
-}
-{
-PFrElement aux_dest = &lvar[80];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[160]);
-}
-{
-PFrElement aux_dest = &lvar[81];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[162]);
-}
-{
-PFrElement aux_dest = &lvar[82];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[164]);
-}
-{
-PFrElement aux_dest = &lvar[83];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[166]);
-}
-{
-PFrElement aux_dest = &lvar[84];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[168]);
-}
-{
-PFrElement aux_dest = &lvar[85];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[170]);
-}
-{
-PFrElement aux_dest = &lvar[86];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[172]);
-}
-{
-PFrElement aux_dest = &lvar[87];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[174]);
-}
-{
-PFrElement aux_dest = &lvar[88];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[176]);
-}
-{
-PFrElement aux_dest = &lvar[89];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[178]);
-}
-{
-PFrElement aux_dest = &lvar[90];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[180]);
-}
-{
-PFrElement aux_dest = &lvar[91];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[182]);
-}
-{
-PFrElement aux_dest = &lvar[92];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[184]);
-}
-{
-PFrElement aux_dest = &lvar[93];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[186]);
-}
-{
-PFrElement aux_dest = &lvar[94];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[188]);
-}
-{
-PFrElement aux_dest = &lvar[95];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[190]);
-}
-{
-PFrElement aux_dest = &lvar[96];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[192]);
-}
-{
-PFrElement aux_dest = &lvar[97];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[194]);
-}
-{
-PFrElement aux_dest = &lvar[98];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[196]);
-}
-{
-PFrElement aux_dest = &lvar[99];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[198]);
-}
-{
-PFrElement aux_dest = &lvar[100];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[200]);
-}
-{
-PFrElement aux_dest = &lvar[101];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[202]);
-}
-{
-PFrElement aux_dest = &lvar[102];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[204]);
-}
-{
-PFrElement aux_dest = &lvar[103];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[206]);
-}
-{
-PFrElement aux_dest = &lvar[104];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[208]);
-}
-{
-PFrElement aux_dest = &lvar[105];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[210]);
-}
-{
-PFrElement aux_dest = &lvar[106];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[212]);
-}
-{
-PFrElement aux_dest = &lvar[107];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[214]);
-}
-{
-PFrElement aux_dest = &lvar[108];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[216]);
-}
-{
-PFrElement aux_dest = &lvar[109];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[218]);
-}
-{
-PFrElement aux_dest = &lvar[110];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[220]);
-}
-{
-PFrElement aux_dest = &lvar[111];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[222]);
-}
-{
-PFrElement aux_dest = &lvar[112];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[224]);
-}
-{
-PFrElement aux_dest = &lvar[113];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[226]);
-}
-{
-PFrElement aux_dest = &lvar[114];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[228]);
-}
-{
-PFrElement aux_dest = &lvar[115];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[230]);
-}
-{
-PFrElement aux_dest = &lvar[116];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[232]);
-}
-{
-PFrElement aux_dest = &lvar[117];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[234]);
-}
-{
-PFrElement aux_dest = &lvar[118];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[236]);
-}
-{
-PFrElement aux_dest = &lvar[119];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[238]);
-}
-{
-PFrElement aux_dest = &lvar[120];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[240]);
-}
-{
-PFrElement aux_dest = &lvar[121];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[242]);
-}
-{
-PFrElement aux_dest = &lvar[122];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[244]);
-}
-{
-PFrElement aux_dest = &lvar[123];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[246]);
-}
-{
-PFrElement aux_dest = &lvar[124];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[248]);
-}
-{
-PFrElement aux_dest = &lvar[125];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[250]);
-}
-{
-PFrElement aux_dest = &lvar[126];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[252]);
-}
-{
-PFrElement aux_dest = &lvar[127];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[254]);
-}
-{
-PFrElement aux_dest = &lvar[128];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[256]);
-}
-{
-PFrElement aux_dest = &lvar[129];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[258]);
-}
-{
-PFrElement aux_dest = &lvar[130];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[260]);
-}
-{
-PFrElement aux_dest = &lvar[131];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[262]);
-}
-{
-PFrElement aux_dest = &lvar[132];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[264]);
-}
-{
-PFrElement aux_dest = &lvar[133];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[266]);
-}
-{
-PFrElement aux_dest = &lvar[134];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[268]);
-}
-{
-PFrElement aux_dest = &lvar[135];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[270]);
-}
-{
-PFrElement aux_dest = &lvar[136];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[272]);
-}
-{
-PFrElement aux_dest = &lvar[137];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[274]);
-}
-{
-PFrElement aux_dest = &lvar[138];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[276]);
-}
-{
-PFrElement aux_dest = &lvar[139];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[278]);
-}
-{
-PFrElement aux_dest = &lvar[140];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[280]);
-}
-{
-PFrElement aux_dest = &lvar[141];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[282]);
-}
-{
-PFrElement aux_dest = &lvar[142];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[284]);
-}
-{
-PFrElement aux_dest = &lvar[143];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[286]);
-}
-{
-PFrElement aux_dest = &lvar[144];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[288]);
-}
-{
-PFrElement aux_dest = &lvar[145];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[290]);
-}
-{
-PFrElement aux_dest = &lvar[146];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[292]);
-}
-{
-PFrElement aux_dest = &lvar[147];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[294]);
-}
-{
-PFrElement aux_dest = &lvar[148];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[296]);
-}
-{
-PFrElement aux_dest = &lvar[149];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[298]);
-}
-{
-PFrElement aux_dest = &lvar[150];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[300]);
-}
-{
-PFrElement aux_dest = &lvar[151];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[302]);
-}
-{
-PFrElement aux_dest = &lvar[152];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[304]);
-}
-{
-PFrElement aux_dest = &lvar[153];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[306]);
-}
-{
-PFrElement aux_dest = &lvar[154];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[308]);
-}
-{
-PFrElement aux_dest = &lvar[155];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[310]);
-}
-{
-PFrElement aux_dest = &lvar[156];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[312]);
-}
-{
-PFrElement aux_dest = &lvar[157];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[314]);
-}
-{
-PFrElement aux_dest = &lvar[158];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[316]);
-}
-{
-PFrElement aux_dest = &lvar[159];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[318]);
-}
-{
-PFrElement aux_dest = &lvar[160];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[320]);
-}
-{
-PFrElement aux_dest = &lvar[161];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[322]);
-}
-{
-PFrElement aux_dest = &lvar[162];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[324]);
-}
-{
-PFrElement aux_dest = &lvar[163];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[326]);
-}
-{
-PFrElement aux_dest = &lvar[164];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[328]);
-}
-{
-PFrElement aux_dest = &lvar[165];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[330]);
-}
-{
-PFrElement aux_dest = &lvar[166];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[332]);
-}
-{
-PFrElement aux_dest = &lvar[167];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[334]);
-}
-{
-PFrElement aux_dest = &lvar[168];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[336]);
-}
-{
-PFrElement aux_dest = &lvar[169];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[338]);
-}
-{
-PFrElement aux_dest = &lvar[170];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[340]);
-}
-{
-PFrElement aux_dest = &lvar[171];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[342]);
-}
-{
-PFrElement aux_dest = &lvar[172];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[344]);
-}
-{
-PFrElement aux_dest = &lvar[173];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[346]);
-}
-{
-PFrElement aux_dest = &lvar[174];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[348]);
-}
-{
-PFrElement aux_dest = &lvar[175];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[350]);
-}
-{
-PFrElement aux_dest = &lvar[176];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[352]);
-}
-{
-PFrElement aux_dest = &lvar[177];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[354]);
-}
-{
-PFrElement aux_dest = &lvar[178];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[356]);
-}
-{
-PFrElement aux_dest = &lvar[179];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[358]);
-}
-{
-PFrElement aux_dest = &lvar[180];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[360]);
-}
-{
-PFrElement aux_dest = &lvar[181];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[362]);
-}
-{
-PFrElement aux_dest = &lvar[182];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[364]);
-}
-{
-PFrElement aux_dest = &lvar[183];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[366]);
-}
-{
-PFrElement aux_dest = &lvar[184];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[368]);
-}
-{
-PFrElement aux_dest = &lvar[185];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[370]);
-}
-{
-PFrElement aux_dest = &lvar[186];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[372]);
-}
-{
-PFrElement aux_dest = &lvar[187];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[374]);
-}
-{
-PFrElement aux_dest = &lvar[188];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[376]);
-}
-{
-PFrElement aux_dest = &lvar[189];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[378]);
-}
-{
-PFrElement aux_dest = &lvar[190];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[380]);
-}
-{
-PFrElement aux_dest = &lvar[191];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[382]);
-}
-{
-PFrElement aux_dest = &lvar[192];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[384]);
-}
-{
-PFrElement aux_dest = &lvar[193];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[386]);
-}
-{
-PFrElement aux_dest = &lvar[194];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[388]);
-}
-{
-PFrElement aux_dest = &lvar[195];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[390]);
-}
-{
-PFrElement aux_dest = &lvar[196];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[392]);
-}
-{
-PFrElement aux_dest = &lvar[197];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[394]);
-}
-{
-PFrElement aux_dest = &lvar[198];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[396]);
-}
-{
-PFrElement aux_dest = &lvar[199];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[398]);
-}
-{
-PFrElement aux_dest = &lvar[200];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[400]);
-}
-{
-PFrElement aux_dest = &lvar[201];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[402]);
-}
-{
-PFrElement aux_dest = &lvar[202];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[404]);
-}
-{
-PFrElement aux_dest = &lvar[203];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[406]);
-}
-{
-PFrElement aux_dest = &lvar[204];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[408]);
-}
-{
-PFrElement aux_dest = &lvar[205];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[410]);
-}
-{
-PFrElement aux_dest = &lvar[206];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[412]);
-}
-{
-PFrElement aux_dest = &lvar[207];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[414]);
-}
-{
-PFrElement aux_dest = &lvar[208];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[416]);
-}
-{
-PFrElement aux_dest = &lvar[209];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[418]);
-}
-{
-PFrElement aux_dest = &lvar[210];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[420]);
-}
-{
-PFrElement aux_dest = &lvar[211];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[422]);
-}
-{
-PFrElement aux_dest = &lvar[212];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[424]);
-}
-{
-PFrElement aux_dest = &lvar[213];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[426]);
-}
-{
-PFrElement aux_dest = &lvar[214];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[428]);
-}
-{
-PFrElement aux_dest = &lvar[215];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[430]);
-}
-{
-PFrElement aux_dest = &lvar[216];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[432]);
-}
-{
-PFrElement aux_dest = &lvar[217];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[434]);
-}
-{
-PFrElement aux_dest = &lvar[218];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[436]);
+HashFleet_2_run,
+NULL,
+HashState_4_run,
+NULL,
+NULL,
+NULL,
+NULL,
+NULL,
+NULL,
+NULL,
+NULL,
+NULL,
+NULL,
+NULL,
+NULL,
+NULL };
+uint get_main_input_signal_start() {return 8;}
+
+uint get_main_input_signal_no() {return 56;}
+
+uint get_total_signal_no() {return 120915;}
+
+uint get_number_of_components() {return 277;}
+
+uint get_size_of_input_hashmap() {return 256;}
+
+uint get_size_of_witness() {return 89860;}
+
+uint get_size_of_constants() {return 439;}
+
+uint get_size_of_io_map() {return 3;}
+
+void release_memory_component(Circom_CalcWit* ctx, uint pos) {{
+
+if (pos != 0){{
+
+if(ctx->componentMemory[pos].subcomponents)
+delete []ctx->componentMemory[pos].subcomponents;
+
+if(ctx->componentMemory[pos].subcomponentsParallel)
+delete []ctx->componentMemory[pos].subcomponentsParallel;
+
+if(ctx->componentMemory[pos].outputIsSet)
+delete []ctx->componentMemory[pos].outputIsSet;
+
+if(ctx->componentMemory[pos].mutexes)
+delete []ctx->componentMemory[pos].mutexes;
+
+if(ctx->componentMemory[pos].cvs)
+delete []ctx->componentMemory[pos].cvs;
+
+if(ctx->componentMemory[pos].sbct)
+delete []ctx->componentMemory[pos].sbct;
+
+}}
+
+
+}}
+
+
+// function declarations
+// template declarations
+void MiMCFeistel_0_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
+ctx->componentMemory[coffset].templateId = 0;
+ctx->componentMemory[coffset].templateName = "MiMCFeistel";
+ctx->componentMemory[coffset].signalStart = soffset;
+ctx->componentMemory[coffset].inputCounter = 3;
+ctx->componentMemory[coffset].componentName = componentName;
+ctx->componentMemory[coffset].idFather = componentFather;
+ctx->componentMemory[coffset].subcomponents = new uint[0];
 }
+
+void MiMCFeistel_0_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[6];
+static const uint lvar_1_constants[218] = {2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,40,42,44,46,48,50,52,54,56,58,60,62,64,66,68,70,72,74,76,78,80,82,84,86,88,90,92,94,96,98,100,102,104,106,108,110,112,114,116,118,120,122,124,126,128,130,132,134,136,138,140,142,144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,240,242,244,246,248,250,252,254,256,258,260,262,264,266,268,270,272,274,276,278,280,282,284,286,288,290,292,294,296,298,300,302,304,306,308,310,312,314,316,318,320,322,324,326,328,330,332,334,336,338,340,342,344,346,348,350,352,354,356,358,360,362,364,366,368,370,372,374,376,378,380,382,384,386,388,390,392,394,396,398,400,402,404,406,408,410,412,414,416,418,420,422,424,426,428,430,432,434,436};
+FrElement lvar[223];
+uint lvar_0, lvar_221;
+uint sub_component_aux;
+uint index_multiple_eq;
+lvar_0 = 220;
 {
 PFrElement aux_dest = &lvar[219];
 // load src
@@ -1474,18 +162,9 @@ PFrElement aux_dest = &lvar[220];
 // end load src
 Fr_copy(aux_dest,&circuitConstants[1]);
 }
-{
-PFrElement aux_dest = &lvar[221];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[221],&circuitConstants[0]); // line circom 275
-while(Fr_isTrue(&expaux[0])){
-Fr_eq(&expaux[1],&lvar[221],&circuitConstants[1]); // line circom 276
-Fr_eq(&expaux[2],&lvar[221],&circuitConstants[437]); // line circom 276
-Fr_lor(&expaux[0],&expaux[1],&expaux[2]); // line circom 276
-if(Fr_isTrue(&expaux[0])){
+lvar_221 = 0;
+while(lvar_221 < 220){
+if((lvar_221 == 0) || (lvar_221 == 219)){
 {
 PFrElement aux_dest = &lvar[220];
 // load src
@@ -1496,13 +175,11 @@ Fr_copy(aux_dest,&circuitConstants[1]);
 {
 PFrElement aux_dest = &lvar[220];
 // load src
-Fr_sub(&expaux[0],&lvar[221],&circuitConstants[3]); // line circom 279
 // end load src
-Fr_copy(aux_dest,&lvar[((1 * Fr_toInt(&expaux[0])) + 1)]);
+Fr_copy(aux_dest,&circuitConstants[lvar_1_constants[(1 * (lvar_221 - 1))]]);
 }
 }
-Fr_eq(&expaux[0],&lvar[221],&circuitConstants[1]); // line circom 281
-if(Fr_isTrue(&expaux[0])){
+if(lvar_221 == 0){
 {
 PFrElement aux_dest = &lvar[219];
 // load src
@@ -1514,31 +191,28 @@ Fr_copy(aux_dest,&expaux[0]);
 {
 PFrElement aux_dest = &lvar[219];
 // load src
-Fr_sub(&expaux[3],&lvar[221],&circuitConstants[3]); // line circom 281
-Fr_add(&expaux[1],&signalValues[mySignalStart + 4],&signalValues[mySignalStart + ((1 * Fr_toInt(&expaux[3])) + 445)]); // line circom 281
+Fr_add(&expaux[1],&signalValues[mySignalStart + 4],&signalValues[mySignalStart + ((1 * (lvar_221 - 1)) + 445)]); // line circom 281
 Fr_add(&expaux[0],&expaux[1],&lvar[220]); // line circom 281
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 5)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_221) + 5)];
 // load src
 Fr_mul(&expaux[0],&lvar[219],&lvar[219]); // line circom 282
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 225)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_221) + 225)];
 // load src
-Fr_mul(&expaux[0],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 5)],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 5)]); // line circom 283
+Fr_mul(&expaux[0],&signalValues[mySignalStart + ((1 * lvar_221) + 5)],&signalValues[mySignalStart + ((1 * lvar_221) + 5)]); // line circom 283
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
-Fr_lt(&expaux[0],&lvar[221],&circuitConstants[437]); // line circom 284
-if(Fr_isTrue(&expaux[0])){
-Fr_eq(&expaux[0],&lvar[221],&circuitConstants[1]); // line circom 285
-if(Fr_isTrue(&expaux[0])){
+if(lvar_221 < 219){
+if(lvar_221 == 0){
 {
 PFrElement aux_dest = &lvar[222];
 // load src
@@ -1549,34 +223,31 @@ Fr_copy(aux_dest,&signalValues[mySignalStart + 3]);
 {
 PFrElement aux_dest = &lvar[222];
 // load src
-Fr_sub(&expaux[0],&lvar[221],&circuitConstants[3]); // line circom 285
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&expaux[0])) + 664)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * (lvar_221 - 1)) + 664)]);
 }
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 445)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_221) + 445)];
 // load src
-Fr_mul(&expaux[2],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 225)],&lvar[219]); // line circom 286
+Fr_mul(&expaux[2],&signalValues[mySignalStart + ((1 * lvar_221) + 225)],&lvar[219]); // line circom 286
 Fr_add(&expaux[0],&lvar[222],&expaux[2]); // line circom 286
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
-Fr_eq(&expaux[0],&lvar[221],&circuitConstants[1]); // line circom 287
-if(Fr_isTrue(&expaux[0])){
+if(lvar_221 == 0){
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 664)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_221) + 664)];
 // load src
 // end load src
 Fr_copy(aux_dest,&signalValues[mySignalStart + 2]);
 }
 }else{
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[221])) + 664)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_221) + 664)];
 // load src
-Fr_sub(&expaux[0],&lvar[221],&circuitConstants[3]); // line circom 287
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&expaux[0])) + 445)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * (lvar_221 - 1)) + 445)]);
 }
 }
 }else{
@@ -1595,22 +266,11 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 Fr_copy(aux_dest,&signalValues[mySignalStart + 663]);
 }
 }
-{
-PFrElement aux_dest = &lvar[221];
-// load src
-Fr_add(&expaux[0],&lvar[221],&circuitConstants[3]); // line circom 275
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[221],&circuitConstants[0]); // line circom 275
-}
-for (uint i = 0; i < 0; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_221 = lvar_221 + 1; // line circom 275
 }
 }
 
-void MiMCSponge_1_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void MiMCSponge_1_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 1;
 ctx->componentMemory[coffset].templateName = "MiMCSponge";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -1618,13 +278,24 @@ ctx->componentMemory[coffset].inputCounter = 18;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[17]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+19;
+static const uint aux_dimensions[1] = {17};
+for (uint i = 0; i < 17; i++) {
+Circom_ComponentName new_cmp_name = {"S", aux_dimensions, 1, i};
+MiMCFeistel_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 883 ;
+aux_cmp_num += 1;
+}
+}
 }
 
-void MiMCSponge_1_run(uint ctx_index,Circom_CalcWit* ctx){
+void MiMCSponge_1_generated_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -1632,56 +303,17 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[5];
-FrElement lvar[4];
+uint lvar_0, lvar_1, lvar_2, lvar_3;
 uint sub_component_aux;
 uint index_multiple_eq;
+lvar_0 = 17;
+lvar_1 = 1;
+lvar_2 = 220;
+lvar_3 = 0;
+lvar_3 = 0;
+while(lvar_3 < 17){
 {
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[35]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[3]);
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[0]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+19;
-uint aux_dimensions[1] = {17};
-for (uint i = 0; i < 17; i++) {
-std::string new_cmp_name = "S"+ctx->generate_position_array(aux_dimensions, 1, i);
-MiMCFeistel_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 883 ;
-aux_cmp_num += 1;
-}
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[35]); // line circom 16
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[3])) + 0);
+uint cmp_index_ref = ((1 * lvar_3) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 4];
 // load src
@@ -1694,8 +326,7 @@ MiMCFeistel_0_run(mySubcomponents[cmp_index_ref],ctx);
 
 }
 }
-Fr_eq(&expaux[0],&lvar[3],&circuitConstants[1]); // line circom 19
-if(Fr_isTrue(&expaux[0])){
+if(lvar_3 == 0){
 {
 uint cmp_index_ref = 0;
 {
@@ -1726,12 +357,11 @@ MiMCFeistel_0_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }else{
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[3])) + 0);
+uint cmp_index_ref = ((1 * lvar_3) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
-Fr_sub(&expaux[1],&lvar[3],&circuitConstants[3]); // line circom 23
-Fr_add(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * Fr_toInt(&expaux[1])) + 0)]].signalStart + 0],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 1)]); // line circom 23
+Fr_add(&expaux[0],&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * (lvar_3 - 1)) + 0)]].signalStart + 0],&signalValues[mySignalStart + ((1 * lvar_3) + 1)]); // line circom 23
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
@@ -1742,13 +372,12 @@ MiMCFeistel_0_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[3])) + 0);
+uint cmp_index_ref = ((1 * lvar_3) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 3];
 // load src
-Fr_sub(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 24
 // end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * Fr_toInt(&expaux[0])) + 0)]].signalStart + 1]);
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * (lvar_3 - 1)) + 0)]].signalStart + 1]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -1757,14 +386,7 @@ MiMCFeistel_0_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 16
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[35]); // line circom 16
+lvar_3 = lvar_3 + 1; // line circom 16
 }
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 0];
@@ -1772,19 +394,20 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[16]].signalStart + 0]);
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-for (uint i = 0; i < 17; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_3 = 0;
 }
+
+// MiMCSponge(17, 220, 1) runs natively, see mimc.hpp
+void MiMCSponge_1_run(uint ctx_index,Circom_CalcWit* ctx){
+#ifdef MIMC_VERIFY
+MiMCSponge_1_generated_run(ctx_index,ctx);
+MiMCSponge_verify(ctx,ctx_index,17,1);
+#else
+MiMCSponge_native(&ctx->signalValues[ctx->componentMemory[ctx_index].signalStart],17,1);
+#endif
 }
 
-void HashFleet_2_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void HashFleet_2_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 2;
 ctx->componentMemory[coffset].templateName = "HashFleet";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -1792,13 +415,23 @@ ctx->componentMemory[coffset].inputCounter = 18;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[1]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+20;
+for (uint i = 0; i < 1; i++) {
+Circom_ComponentName new_cmp_name = {"MiMCSponge_31_825", NULL, 0, 0};
+MiMCSponge_1_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 15030 ;
+aux_cmp_num += 18;
+}
+}
 }
 
 void HashFleet_2_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -1810,18 +443,6 @@ FrElement lvar[0];
 uint sub_component_aux;
 uint index_multiple_eq;
 {
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+20;
-for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "MiMCSponge_31_825";
-MiMCSponge_1_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 15030 ;
-aux_cmp_num += 18;
-}
-}
-{
 uint cmp_index_ref = 0;
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
@@ -1856,13 +477,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&signalValues[mySignalStart + 19]);
 }
-for (uint i = 0; i < 1; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void MiMCSponge_3_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void MiMCSponge_3_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 3;
 ctx->componentMemory[coffset].templateName = "MiMCSponge";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -1870,13 +487,24 @@ ctx->componentMemory[coffset].inputCounter = 3;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[2]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+4;
+static const uint aux_dimensions[1] = {2};
+for (uint i = 0; i < 2; i++) {
+Circom_ComponentName new_cmp_name = {"S", aux_dimensions, 1, i};
+MiMCFeistel_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 883 ;
+aux_cmp_num += 1;
+}
+}
 }
 
-void MiMCSponge_3_run(uint ctx_index,Circom_CalcWit* ctx){
+void MiMCSponge_3_generated_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -1884,56 +512,17 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[3];
-FrElement lvar[4];
+uint lvar_0, lvar_1, lvar_2, lvar_3;
 uint sub_component_aux;
 uint index_multiple_eq;
+lvar_0 = 2;
+lvar_1 = 1;
+lvar_2 = 220;
+lvar_3 = 0;
+lvar_3 = 0;
+while(lvar_3 < 2){
 {
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[5]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[3]);
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[0]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+4;
-uint aux_dimensions[1] = {2};
-for (uint i = 0; i < 2; i++) {
-std::string new_cmp_name = "S"+ctx->generate_position_array(aux_dimensions, 1, i);
-MiMCFeistel_0_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 883 ;
-aux_cmp_num += 1;
-}
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[5]); // line circom 16
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[3])) + 0);
+uint cmp_index_ref = ((1 * lvar_3) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 4];
 // load src
@@ -1946,8 +535,7 @@ MiMCFeistel_0_run(mySubcomponents[cmp_index_ref],ctx);
 
 }
 }
-Fr_eq(&expaux[0],&lvar[3],&circuitConstants[1]); // line circom 19
-if(Fr_isTrue(&expaux[0])){
+if(lvar_3 == 0){
 {
 uint cmp_index_ref = 0;
 {
@@ -2007,14 +595,7 @@ MiMCFeistel_0_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 16
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[5]); // line circom 16
+lvar_3 = lvar_3 + 1; // line circom 16
 }
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 0];
@@ -2022,19 +603,20 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[1]].signalStart + 0]);
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-for (uint i = 0; i < 2; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
+lvar_3 = 0;
 }
+
+// MiMCSponge(2, 220, 1) runs natively, see mimc.hpp
+void MiMCSponge_3_run(uint ctx_index,Circom_CalcWit* ctx){
+#ifdef MIMC_VERIFY
+MiMCSponge_3_generated_run(ctx_index,ctx);
+MiMCSponge_verify(ctx,ctx_index,2,1);
+#else
+MiMCSponge_native(&ctx->signalValues[ctx->componentMemory[ctx_index].signalStart],2,1);
+#endif
 }
 
-void HashState_4_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void HashState_4_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 4;
 ctx->componentMemory[coffset].templateName = "HashState";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2042,69 +624,57 @@ ctx->componentMemory[coffset].inputCounter = 35;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[18]{0};
-}
-
-void HashState_4_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[3];
-FrElement lvar[2];
-uint sub_component_aux;
-uint index_multiple_eq;
 {
 uint aux_create = 0;
-int aux_cmp_num = 51+ctx_index+1;
-uint csoffset = mySignalStart+30161;
+int aux_cmp_num = 51+coffset+1;
+uint csoffset = soffset+30161;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "MiMCSponge_61_1908";
-MiMCSponge_1_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"MiMCSponge_61_1908", NULL, 0, 0};
+MiMCSponge_1_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 15030 ;
 aux_cmp_num += 18;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+71;
-uint aux_dimensions[1] = {17};
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+71;
+static const uint aux_dimensions[1] = {17};
 for (uint i = 0; i < 17; i++) {
-std::string new_cmp_name = "MiMCSponge_56_1713"+ctx->generate_position_array(aux_dimensions, 1, i);
-MiMCSponge_3_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"MiMCSponge_56_1713", aux_dimensions, 1, i};
+MiMCSponge_3_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 1770 ;
 aux_cmp_num += 3;
 }
 }
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
 }
-Fr_lt(&expaux[0],&lvar[1],&circuitConstants[35]); // line circom 55
-while(Fr_isTrue(&expaux[0])){
+
+void HashState_4_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[3];
+uint lvar_0, lvar_1;
+uint sub_component_aux;
+uint index_multiple_eq;
+#ifdef MIMC_VERIFY
+lvar_0 = 0;
+lvar_1 = 0;
+while(lvar_1 < 17){
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[0])) + 1);
+uint cmp_index_ref = ((1 * lvar_0) + 1);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[1])) + 1)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_1) + 1)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2113,12 +683,12 @@ MiMCSponge_3_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[0])) + 1);
+uint cmp_index_ref = ((1 * lvar_0) + 1);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[1])) + 18)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_1) + 18)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2127,7 +697,7 @@ MiMCSponge_3_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[0])) + 1);
+uint cmp_index_ref = ((1 * lvar_0) + 1);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 3];
 // load src
@@ -2141,33 +711,45 @@ MiMCSponge_3_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[1])) + 36)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_1) + 36)];
 // load src
 // end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * Fr_toInt(&lvar[0])) + 1)]].signalStart + 0]);
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * lvar_0) + 1)]].signalStart + 0]);
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[1])) + 53)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_1) + 53)];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + (((1 * Fr_toInt(&lvar[1])) + 0) + 36)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + (((1 * lvar_1) + 0) + 36)]);
 }
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-Fr_add(&expaux[0],&lvar[1],&circuitConstants[3]); // line circom 55
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
+lvar_1 = lvar_1 + 1; // line circom 55
+lvar_0 = lvar_0 + 1; // line circom 55
 }
+MiMCSponge_verify_lanes(ctx,&mySubcomponents[1],17,2,1);
+#else
+// the 17 leaf sponges MiMCSponge(2, 220, 1) are independent: they run in lockstep,
+// one group of lanes per free thread
 {
-PFrElement aux_dest = &lvar[0];
-// load src
-Fr_add(&expaux[0],&lvar[0],&circuitConstants[3]); // line circom 55
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
+PFrElement leaves[17];
+for (uint i = 0; i < 17; i++) {
+uint cmp_index_ref = i + 1;
+leaves[i] = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart];
+Fr_copy(&leaves[i][1],&signalValues[mySignalStart + i + 1]);
+Fr_copy(&leaves[i][2],&signalValues[mySignalStart + i + 18]);
+Fr_copy(&leaves[i][3],&signalValues[mySignalStart + 35]);
+ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 3;
+}
+uint width = MiMCSponge_lanesWidth();
+ctx->parallelFor((17 + width - 1) / width, [&](uint j) {
+uint first = j * width;
+MiMCSponge_native_lanes(&leaves[first],17 - first < width ? 17 - first : width,2,1);
+});
+for (uint i = 0; i < 17; i++) {
+Fr_copy(&signalValues[mySignalStart + i + 36],&leaves[i][0]);
+Fr_copy(&signalValues[mySignalStart + i + 53],&signalValues[mySignalStart + i + 36]);
 }
-Fr_lt(&expaux[0],&lvar[1],&circuitConstants[35]); // line circom 55
 }
+#endif
 {
 uint cmp_index_ref = 0;
 {
@@ -2203,13 +785,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&signalValues[mySignalStart + 70]);
 }
-for (uint i = 0; i < 18; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void IsZero_5_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void IsZero_5_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 5;
 ctx->componentMemory[coffset].templateName = "IsZero";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2222,8 +800,6 @@ ctx->componentMemory[coffset].subcomponents = new uint[0];
 void IsZero_5_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -2234,43 +810,26 @@ FrElement expaux[4];
 FrElement lvar[0];
 uint sub_component_aux;
 uint index_multiple_eq;
-Fr_neq(&expaux[0],&signalValues[mySignalStart + 1],&circuitConstants[1]); // line circom 30
-if(Fr_isTrue(&expaux[0])){
-{
-PFrElement aux_dest = &signalValues[mySignalStart + 2];
-// load src
-Fr_div(&expaux[0],&circuitConstants[3],&signalValues[mySignalStart + 1]); // line circom 30
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-}else{
-{
-PFrElement aux_dest = &signalValues[mySignalStart + 2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-}
+// inv is only read back by the witness: inverted with the others after the run,
+// which gives 0 for in == 0 without a branch on the input
+ctx->deferInverse(&signalValues[mySignalStart + 2],&signalValues[mySignalStart + 1]); // line circom 30
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // load src
-Fr_neg(&expaux[2],&signalValues[mySignalStart + 1]); // line circom 32
-Fr_mul(&expaux[1],&expaux[2],&signalValues[mySignalStart + 2]); // line circom 32
-Fr_add(&expaux[0],&expaux[1],&circuitConstants[3]); // line circom 32
+// -in*inv + 1 is in == 0, without the deferred inv
+Fr_eq(&expaux[0],&signalValues[mySignalStart + 1],&circuitConstants[1]); // line circom 32
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
+#ifndef TRUSTED_INPUTS
 Fr_mul(&expaux[1],&signalValues[mySignalStart + 1],&signalValues[mySignalStart + 0]); // line circom 33
 Fr_eq(&expaux[0],&expaux[1],&circuitConstants[1]); // line circom 33
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 33. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,33);
 assert(Fr_isTrue(&expaux[0]));
-for (uint i = 0; i < 0; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
+#endif
 }
 
-void IsEqual_6_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void IsEqual_6_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 6;
 ctx->componentMemory[coffset].templateName = "IsEqual";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2278,13 +837,23 @@ ctx->componentMemory[coffset].inputCounter = 2;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[1]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+3;
+for (uint i = 0; i < 1; i++) {
+Circom_ComponentName new_cmp_name = {"isz", NULL, 0, 0};
+IsZero_5_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 3 ;
+aux_cmp_num += 1;
+}
+}
 }
 
 void IsEqual_6_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -2296,18 +865,6 @@ FrElement lvar[0];
 uint sub_component_aux;
 uint index_multiple_eq;
 {
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+3;
-for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "isz";
-IsZero_5_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 3 ;
-aux_cmp_num += 1;
-}
-}
-{
 uint cmp_index_ref = 0;
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
@@ -2326,13 +883,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[0]].signalStart + 0]);
 }
-for (uint i = 0; i < 1; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void RequireBinary_7_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void RequireBinary_7_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 7;
 ctx->componentMemory[coffset].templateName = "RequireBinary";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2345,8 +898,6 @@ ctx->componentMemory[coffset].subcomponents = new uint[0];
 void RequireBinary_7_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -2357,18 +908,16 @@ FrElement expaux[6];
 FrElement lvar[0];
 uint sub_component_aux;
 uint index_multiple_eq;
+#ifndef TRUSTED_INPUTS
 Fr_sub(&expaux[3],&signalValues[mySignalStart + 0],&circuitConstants[3]); // line circom 26
 Fr_mul(&expaux[1],&signalValues[mySignalStart + 0],&expaux[3]); // line circom 26
 Fr_eq(&expaux[0],&expaux[1],&circuitConstants[1]); // line circom 26
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 26. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,26);
 assert(Fr_isTrue(&expaux[0]));
-for (uint i = 0; i < 0; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
+#endif
 }
 
-void BinaryArrayCount_8_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void BinaryArrayCount_8_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 8;
 ctx->componentMemory[coffset].templateName = "BinaryArrayCount";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2376,13 +925,24 @@ ctx->componentMemory[coffset].inputCounter = 17;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[17]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+36;
+static const uint aux_dimensions[1] = {17};
+for (uint i = 0; i < 17; i++) {
+Circom_ComponentName new_cmp_name = {"RequireBinary_118_3317", aux_dimensions, 1, i};
+RequireBinary_7_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 1 ;
+aux_cmp_num += 1;
+}
+}
 }
 
 void BinaryArrayCount_8_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -2390,55 +950,26 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[3];
-FrElement lvar[3];
+uint lvar_0, lvar_1, lvar_2;
 uint sub_component_aux;
 uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[35]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+36;
-uint aux_dimensions[1] = {17};
-for (uint i = 0; i < 17; i++) {
-std::string new_cmp_name = "RequireBinary_118_3317"+ctx->generate_position_array(aux_dimensions, 1, i);
-RequireBinary_7_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 1 ;
-aux_cmp_num += 1;
-}
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
+lvar_0 = 17;
+lvar_1 = 0;
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 18];
 // load src
 // end load src
 Fr_copy(aux_dest,&circuitConstants[1]);
 }
+lvar_2 = 0;
+while(lvar_2 < 17){
 {
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[35]); // line circom 116
-while(Fr_isTrue(&expaux[0])){
-{
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[1])) + 0);
+uint cmp_index_ref = ((1 * lvar_1) + 0);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 0];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[2])) + 1)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_2) + 1)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2447,27 +978,14 @@ RequireBinary_7_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * (Fr_toInt(&lvar[2]) + 1)) + 18)];
-// load src
-Fr_add(&expaux[0],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[2])) + 18)],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[2])) + 1)]); // line circom 119
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-Fr_add(&expaux[0],&lvar[2],&circuitConstants[3]); // line circom 116
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-{
-PFrElement aux_dest = &lvar[1];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * (lvar_2 + 1)) + 18)];
 // load src
-Fr_add(&expaux[0],&lvar[1],&circuitConstants[3]); // line circom 116
+Fr_add(&expaux[0],&signalValues[mySignalStart + ((1 * lvar_2) + 18)],&signalValues[mySignalStart + ((1 * lvar_2) + 1)]); // line circom 119
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
-Fr_lt(&expaux[0],&lvar[2],&circuitConstants[35]); // line circom 116
+lvar_2 = lvar_2 + 1; // line circom 116
+lvar_1 = lvar_1 + 1; // line circom 116
 }
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 0];
@@ -2475,13 +993,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&signalValues[mySignalStart + 35]);
 }
-for (uint i = 0; i < 17; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void ProcessMove_9_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void ProcessMove_9_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 9;
 ctx->componentMemory[coffset].templateName = "ProcessMove";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2489,89 +1003,76 @@ ctx->componentMemory[coffset].inputCounter = 35;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[36]{0};
-}
-
-void ProcessMove_9_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[3];
-FrElement lvar[2];
-uint sub_component_aux;
-uint index_multiple_eq;
 {
 uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+70;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+70;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "BinaryArrayCount_95_3236";
-BinaryArrayCount_8_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"BinaryArrayCount_95_3236", NULL, 0, 0};
+BinaryArrayCount_8_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 53 ;
 aux_cmp_num += 18;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 69+ctx_index+1;
-uint csoffset = mySignalStart+242;
+int aux_cmp_num = 69+coffset+1;
+uint csoffset = soffset+242;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "RequireBinary_96_3274";
-RequireBinary_7_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"RequireBinary_96_3274", NULL, 0, 0};
+RequireBinary_7_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 1 ;
 aux_cmp_num += 1;
 }
 }
 {
 uint aux_create = 2;
-int aux_cmp_num = 18+ctx_index+1;
-uint csoffset = mySignalStart+123;
-uint aux_dimensions[1] = {17};
+int aux_cmp_num = 18+coffset+1;
+uint csoffset = soffset+123;
+static const uint aux_dimensions[1] = {17};
 for (uint i = 0; i < 17; i++) {
-std::string new_cmp_name = "IsEqual_86_2837"+ctx->generate_position_array(aux_dimensions, 1, i);
-IsEqual_6_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"IsEqual_86_2837", aux_dimensions, 1, i};
+IsEqual_6_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 6 ;
 aux_cmp_num += 2;
 }
 }
 {
 uint aux_create = 19;
-int aux_cmp_num = 52+ctx_index+1;
-uint csoffset = mySignalStart+225;
-uint aux_dimensions[1] = {17};
+int aux_cmp_num = 52+coffset+1;
+uint csoffset = soffset+225;
+static const uint aux_dimensions[1] = {17};
 for (uint i = 0; i < 17; i++) {
-std::string new_cmp_name = "RequireBinary_90_3021"+ctx->generate_position_array(aux_dimensions, 1, i);
-RequireBinary_7_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"RequireBinary_90_3021", aux_dimensions, 1, i};
+RequireBinary_7_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 1 ;
 aux_cmp_num += 1;
 }
 }
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
 }
-Fr_lt(&expaux[0],&lvar[1],&circuitConstants[35]); // line circom 84
-while(Fr_isTrue(&expaux[0])){
+
+void ProcessMove_9_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[3];
+uint lvar_0, lvar_1;
+uint sub_component_aux;
+uint index_multiple_eq;
+lvar_0 = 0;
+lvar_1 = 0;
+while(lvar_1 < 17){
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[0])) + 2);
+uint cmp_index_ref = ((1 * lvar_0) + 2);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
@@ -2585,12 +1086,12 @@ IsEqual_6_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[0])) + 2);
+uint cmp_index_ref = ((1 * lvar_0) + 2);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 2];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[1])) + 36)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_1) + 36)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2599,25 +1100,25 @@ IsEqual_6_run(mySubcomponents[cmp_index_ref],ctx);
 }
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[1])) + 53)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_1) + 53)];
 // load src
 // end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * Fr_toInt(&lvar[0])) + 2)]].signalStart + 0]);
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[((1 * lvar_0) + 2)]].signalStart + 0]);
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[1])) + 0)];
+PFrElement aux_dest = &signalValues[mySignalStart + ((1 * lvar_1) + 0)];
 // load src
-Fr_add(&expaux[0],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[1])) + 36)],&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[1])) + 53)]); // line circom 89
+Fr_add(&expaux[0],&signalValues[mySignalStart + ((1 * lvar_1) + 36)],&signalValues[mySignalStart + ((1 * lvar_1) + 53)]); // line circom 89
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
 {
-uint cmp_index_ref = ((1 * Fr_toInt(&lvar[0])) + 19);
+uint cmp_index_ref = ((1 * lvar_0) + 19);
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 0];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[1])) + 0)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_1) + 0)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2625,21 +1126,8 @@ RequireBinary_7_run(mySubcomponents[cmp_index_ref],ctx);
 
 }
 }
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-Fr_add(&expaux[0],&lvar[1],&circuitConstants[3]); // line circom 84
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-Fr_add(&expaux[0],&lvar[0],&circuitConstants[3]); // line circom 84
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[1],&circuitConstants[35]); // line circom 84
+lvar_1 = lvar_1 + 1; // line circom 84
+lvar_0 = lvar_0 + 1; // line circom 84
 }
 {
 uint cmp_index_ref = 0;
@@ -2671,13 +1159,9 @@ Fr_copy(aux_dest,&signalValues[mySignalStart + 17]);
 assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1));
 RequireBinary_7_run(mySubcomponents[cmp_index_ref],ctx);
 }
-for (uint i = 0; i < 36; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void AND_10_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void AND_10_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 10;
 ctx->componentMemory[coffset].templateName = "AND";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2690,8 +1174,6 @@ ctx->componentMemory[coffset].subcomponents = new uint[0];
 void AND_10_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -2709,13 +1191,9 @@ Fr_mul(&expaux[0],&signalValues[mySignalStart + 1],&signalValues[mySignalStart +
 // end load src
 Fr_copy(aux_dest,&expaux[0]);
 }
-for (uint i = 0; i < 0; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void MultiAND_11_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void MultiAND_11_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 11;
 ctx->componentMemory[coffset].templateName = "MultiAND";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2728,8 +1206,6 @@ ctx->componentMemory[coffset].subcomponents = new uint[0];
 void MultiAND_11_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -2737,28 +1213,19 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[1];
-FrElement lvar[1];
+uint lvar_0;
 uint sub_component_aux;
 uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[3]);
-}
+lvar_0 = 1;
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // load src
 // end load src
 Fr_copy(aux_dest,&signalValues[mySignalStart + 1]);
 }
-for (uint i = 0; i < 0; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void MultiAND_12_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void MultiAND_12_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 12;
 ctx->componentMemory[coffset].templateName = "MultiAND";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2766,13 +1233,23 @@ ctx->componentMemory[coffset].inputCounter = 2;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[1]{0};
+{
+uint aux_create = 0;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+3;
+for (uint i = 0; i < 1; i++) {
+Circom_ComponentName new_cmp_name = {"and1", NULL, 0, 0};
+AND_10_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+csoffset += 3 ;
+aux_cmp_num += 1;
+}
+}
 }
 
 void MultiAND_12_run(uint ctx_index,Circom_CalcWit* ctx){
 FrElement* signalValues = ctx->signalValues;
 u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
 u64 myFather = ctx->componentMemory[ctx_index].idFather;
 u64 myId = ctx_index;
 u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
@@ -2780,27 +1257,10 @@ bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsPar
 FrElement* circuitConstants = ctx->circuitConstants;
 std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
 FrElement expaux[2];
-FrElement lvar[1];
+uint lvar_0;
 uint sub_component_aux;
 uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[5]);
-}
-{
-uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+3;
-for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "and1";
-AND_10_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
-csoffset += 3 ;
-aux_cmp_num += 1;
-}
-}
+lvar_0 = 2;
 {
 uint cmp_index_ref = 0;
 {
@@ -2830,13 +1290,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[0]].signalStart + 0]);
 }
-for (uint i = 0; i < 1; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void MultiAND_13_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void MultiAND_13_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 13;
 ctx->componentMemory[coffset].templateName = "MultiAND";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -2844,91 +1300,63 @@ ctx->componentMemory[coffset].inputCounter = 3;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[3]{0};
-}
-
-void MultiAND_13_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[3];
-FrElement lvar[4];
-uint sub_component_aux;
-uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[7]);
-}
 {
 uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+4;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+4;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "and2";
-AND_10_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"and2", NULL, 0, 0};
+AND_10_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 3 ;
 aux_cmp_num += 1;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 1+ctx_index+1;
-uint csoffset = mySignalStart+7;
+int aux_cmp_num = 1+coffset+1;
+uint csoffset = soffset+7;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "ands[0]";
-MultiAND_11_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"ands[0]", NULL, 0, 0};
+MultiAND_11_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 0 ;
 aux_cmp_num += 0;
 }
 }
 {
 uint aux_create = 2;
-int aux_cmp_num = 2+ctx_index+1;
-uint csoffset = mySignalStart+9;
+int aux_cmp_num = 2+coffset+1;
+uint csoffset = soffset+9;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "ands[1]";
-MultiAND_12_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"ands[1]", NULL, 0, 0};
+MultiAND_12_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 0 ;
 aux_cmp_num += 0;
 }
 }
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[3]);
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[5]);
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
 }
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 88
-while(Fr_isTrue(&expaux[0])){
+
+void MultiAND_13_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[3];
+uint lvar_0, lvar_1, lvar_2, lvar_3;
+uint sub_component_aux;
+uint index_multiple_eq;
+lvar_0 = 3;
+lvar_1 = 1;
+lvar_2 = 2;
+lvar_3 = 0;
+lvar_3 = 0;
+while(lvar_3 < 1){
 {
 uint cmp_index_ref = 1;
 {
@@ -2947,32 +1375,20 @@ if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
 }
 }
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[3]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 88
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
+lvar_3 = 1;
 }
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[5]); // line circom 89
-while(Fr_isTrue(&expaux[0])){
+lvar_3 = 0;
+while(lvar_3 < 2){
 {
 uint cmp_index_ref = 2;
 {
 uint map_index_aux[1];
-map_index_aux[0]=Fr_toInt(&lvar[3]);
+map_index_aux[0]=lvar_3;
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + ctx->templateInsId2IOSignalInfo[ctx->componentMemory[mySubcomponents[cmp_index_ref]].templateId].defs[1].offset+map_index_aux[0]];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * (1 + Fr_toInt(&lvar[3]))) + 1)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * (1 + lvar_3)) + 1)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -2981,14 +1397,7 @@ if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
 }
 }
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 89
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[5]); // line circom 89
+lvar_3 = lvar_3 + 1; // line circom 89
 }
 {
 uint cmp_index_ref = 0;
@@ -3019,13 +1428,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[0]].signalStart + 0]);
 }
-for (uint i = 0; i < 3; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void MultiAND_14_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void MultiAND_14_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 14;
 ctx->componentMemory[coffset].templateName = "MultiAND";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -3033,87 +1438,59 @@ ctx->componentMemory[coffset].inputCounter = 4;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[3]{0};
-}
-
-void MultiAND_14_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[3];
-FrElement lvar[4];
-uint sub_component_aux;
-uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[9]);
-}
 {
 uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+5;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+5;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "and2";
-AND_10_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"and2", NULL, 0, 0};
+AND_10_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 3 ;
 aux_cmp_num += 1;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 1+ctx_index+1;
-uint csoffset = mySignalStart+8;
-uint aux_dimensions[1] = {2};
+int aux_cmp_num = 1+coffset+1;
+uint csoffset = soffset+8;
+static const uint aux_dimensions[1] = {2};
 for (uint i = 0; i < 2; i++) {
-std::string new_cmp_name = "ands"+ctx->generate_position_array(aux_dimensions, 1, i);
-MultiAND_12_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"ands", aux_dimensions, 1, i};
+MultiAND_12_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 6 ;
 aux_cmp_num += 2;
 }
 }
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[5]);
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[5]);
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
 }
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[5]); // line circom 88
-while(Fr_isTrue(&expaux[0])){
+
+void MultiAND_14_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[3];
+uint lvar_0, lvar_1, lvar_2, lvar_3;
+uint sub_component_aux;
+uint index_multiple_eq;
+lvar_0 = 4;
+lvar_1 = 2;
+lvar_2 = 2;
+lvar_3 = 0;
+lvar_3 = 0;
+while(lvar_3 < 2){
 {
 uint cmp_index_ref = 1;
 {
-PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + ((1 * Fr_toInt(&lvar[3])) + 1)];
+PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + ((1 * lvar_3) + 1)];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 1)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_3) + 1)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -3121,30 +1498,17 @@ MultiAND_12_run(mySubcomponents[cmp_index_ref],ctx);
 
 }
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 88
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[5]); // line circom 88
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
+lvar_3 = lvar_3 + 1; // line circom 88
 }
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[5]); // line circom 89
-while(Fr_isTrue(&expaux[0])){
+lvar_3 = 0;
+while(lvar_3 < 2){
 {
 uint cmp_index_ref = 2;
 {
-PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + ((1 * Fr_toInt(&lvar[3])) + 1)];
+PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + ((1 * lvar_3) + 1)];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * (2 + Fr_toInt(&lvar[3]))) + 1)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * (2 + lvar_3)) + 1)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -3152,14 +1516,7 @@ MultiAND_12_run(mySubcomponents[cmp_index_ref],ctx);
 
 }
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 89
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[5]); // line circom 89
+lvar_3 = lvar_3 + 1; // line circom 89
 }
 {
 uint cmp_index_ref = 0;
@@ -3190,13 +1547,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[0]].signalStart + 0]);
 }
-for (uint i = 0; i < 3; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void MultiAND_15_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void MultiAND_15_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 15;
 ctx->componentMemory[coffset].templateName = "MultiAND";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -3204,101 +1557,73 @@ ctx->componentMemory[coffset].inputCounter = 5;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[3]{0};
-}
-
-void MultiAND_15_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[3];
-FrElement lvar[4];
-uint sub_component_aux;
-uint index_multiple_eq;
-{
-PFrElement aux_dest = &lvar[0];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[11]);
-}
 {
 uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+6;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+6;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "and2";
-AND_10_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"and2", NULL, 0, 0};
+AND_10_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 3 ;
 aux_cmp_num += 1;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 1+ctx_index+1;
-uint csoffset = mySignalStart+9;
+int aux_cmp_num = 1+coffset+1;
+uint csoffset = soffset+9;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "ands[0]";
-MultiAND_12_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"ands[0]", NULL, 0, 0};
+MultiAND_12_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 0 ;
 aux_cmp_num += 0;
 }
 }
 {
 uint aux_create = 2;
-int aux_cmp_num = 3+ctx_index+1;
-uint csoffset = mySignalStart+15;
+int aux_cmp_num = 3+coffset+1;
+uint csoffset = soffset+15;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "ands[1]";
-MultiAND_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"ands[1]", NULL, 0, 0};
+MultiAND_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 0 ;
 aux_cmp_num += 0;
 }
 }
-{
-PFrElement aux_dest = &lvar[1];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[5]);
-}
-{
-PFrElement aux_dest = &lvar[2];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[7]);
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
 }
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[5]); // line circom 88
-while(Fr_isTrue(&expaux[0])){
+
+void MultiAND_15_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[3];
+uint lvar_0, lvar_1, lvar_2, lvar_3;
+uint sub_component_aux;
+uint index_multiple_eq;
+lvar_0 = 5;
+lvar_1 = 2;
+lvar_2 = 3;
+lvar_3 = 0;
+lvar_3 = 0;
+while(lvar_3 < 2){
 {
 uint cmp_index_ref = 1;
 {
 uint map_index_aux[1];
-map_index_aux[0]=Fr_toInt(&lvar[3]);
+map_index_aux[0]=lvar_3;
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + ctx->templateInsId2IOSignalInfo[ctx->componentMemory[mySubcomponents[cmp_index_ref]].templateId].defs[1].offset+map_index_aux[0]];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * Fr_toInt(&lvar[3])) + 1)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * lvar_3) + 1)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -3307,33 +1632,20 @@ if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
 }
 }
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 88
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[5]); // line circom 88
-}
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-// end load src
-Fr_copy(aux_dest,&circuitConstants[1]);
+lvar_3 = lvar_3 + 1; // line circom 88
 }
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[7]); // line circom 89
-while(Fr_isTrue(&expaux[0])){
+lvar_3 = 0;
+while(lvar_3 < 3){
 {
 uint cmp_index_ref = 2;
 {
 uint map_index_aux[1];
-map_index_aux[0]=Fr_toInt(&lvar[3]);
+map_index_aux[0]=lvar_3;
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + ctx->templateInsId2IOSignalInfo[ctx->componentMemory[mySubcomponents[cmp_index_ref]].templateId].defs[1].offset+map_index_aux[0]];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * (2 + Fr_toInt(&lvar[3]))) + 1)]);
+Fr_copy(aux_dest,&signalValues[mySignalStart + ((1 * (2 + lvar_3)) + 1)]);
 }
 // run sub component if needed
 if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
@@ -3342,14 +1654,7 @@ if(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1)){
 }
 }
 }
-{
-PFrElement aux_dest = &lvar[3];
-// load src
-Fr_add(&expaux[0],&lvar[3],&circuitConstants[3]); // line circom 89
-// end load src
-Fr_copy(aux_dest,&expaux[0]);
-}
-Fr_lt(&expaux[0],&lvar[3],&circuitConstants[7]); // line circom 89
+lvar_3 = lvar_3 + 1; // line circom 89
 }
 {
 uint cmp_index_ref = 0;
@@ -3380,13 +1685,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[0]].signalStart + 0]);
 }
-for (uint i = 0; i < 3; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void GetSunk_16_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void GetSunk_16_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 16;
 ctx->componentMemory[coffset].templateName = "GetSunk";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -3394,83 +1695,81 @@ ctx->componentMemory[coffset].inputCounter = 17;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[5]{0};
-}
-
-void GetSunk_16_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[2];
-FrElement lvar[0];
-uint sub_component_aux;
-uint index_multiple_eq;
 {
 uint aux_create = 0;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+22;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+22;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "AND_111_3712";
-AND_10_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"AND_111_3712", NULL, 0, 0};
+AND_10_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 3 ;
 aux_cmp_num += 1;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 1+ctx_index+1;
-uint csoffset = mySignalStart+25;
+int aux_cmp_num = 1+coffset+1;
+uint csoffset = soffset+25;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "MultiAND_112_3758";
-MultiAND_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"MultiAND_112_3758", NULL, 0, 0};
+MultiAND_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 15 ;
 aux_cmp_num += 5;
 }
 }
 {
 uint aux_create = 2;
-int aux_cmp_num = 6+ctx_index+1;
-uint csoffset = mySignalStart+40;
+int aux_cmp_num = 6+coffset+1;
+uint csoffset = soffset+40;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "MultiAND_113_3822";
-MultiAND_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"MultiAND_113_3822", NULL, 0, 0};
+MultiAND_13_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 15 ;
 aux_cmp_num += 5;
 }
 }
 {
 uint aux_create = 3;
-int aux_cmp_num = 11+ctx_index+1;
-uint csoffset = mySignalStart+55;
+int aux_cmp_num = 11+coffset+1;
+uint csoffset = soffset+55;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "MultiAND_114_3886";
-MultiAND_14_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"MultiAND_114_3886", NULL, 0, 0};
+MultiAND_14_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 20 ;
 aux_cmp_num += 6;
 }
 }
 {
 uint aux_create = 4;
-int aux_cmp_num = 17+ctx_index+1;
-uint csoffset = mySignalStart+75;
+int aux_cmp_num = 17+coffset+1;
+uint csoffset = soffset+75;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "MultiAND_115_3962";
-MultiAND_15_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"MultiAND_115_3962", NULL, 0, 0};
+MultiAND_15_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 30 ;
 aux_cmp_num += 9;
 }
 }
+}
+
+void GetSunk_16_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[2];
+FrElement lvar[0];
+uint sub_component_aux;
+uint index_multiple_eq;
 {
 uint cmp_index_ref = 0;
 {
@@ -3693,13 +1992,9 @@ PFrElement aux_dest = &signalValues[mySignalStart + 4];
 // end load src
 Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[4]].signalStart + 0]);
 }
-for (uint i = 0; i < 5; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
-}
 }
 
-void UpdateState_17_create(uint soffset,uint coffset,Circom_CalcWit* ctx,std::string componentName,uint componentFather){
+void UpdateState_17_create(uint soffset,uint coffset,Circom_CalcWit* ctx,Circom_ComponentName componentName,uint componentFather){
 ctx->componentMemory[coffset].templateId = 17;
 ctx->componentMemory[coffset].templateName = "UpdateState";
 ctx->componentMemory[coffset].signalStart = soffset;
@@ -3707,95 +2002,98 @@ ctx->componentMemory[coffset].inputCounter = 56;
 ctx->componentMemory[coffset].componentName = componentName;
 ctx->componentMemory[coffset].idFather = componentFather;
 ctx->componentMemory[coffset].subcomponents = new uint[6]{0};
-}
-
-void UpdateState_17_run(uint ctx_index,Circom_CalcWit* ctx){
-FrElement* signalValues = ctx->signalValues;
-u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
-std::string myTemplateName = ctx->componentMemory[ctx_index].templateName;
-std::string myComponentName = ctx->componentMemory[ctx_index].componentName;
-u64 myFather = ctx->componentMemory[ctx_index].idFather;
-u64 myId = ctx_index;
-u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
-bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
-FrElement* circuitConstants = ctx->circuitConstants;
-std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
-FrElement expaux[3];
-FrElement lvar[0];
-uint sub_component_aux;
-uint index_multiple_eq;
+ctx->componentMemory[coffset].subcomponentsParallel = new bool[6]{false};
+ctx->componentMemory[coffset].sbct = new std::thread[6];
 {
 uint aux_create = 0;
-int aux_cmp_num = 27+ctx_index+1;
-uint csoffset = mySignalStart+189;
+int aux_cmp_num = 27+coffset+1;
+uint csoffset = soffset+189;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "HashFleet_50_1786";
-HashFleet_2_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"HashFleet_50_1786", NULL, 0, 0};
+HashFleet_2_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+ctx->componentMemory[coffset].subcomponentsParallel[aux_create+i] = true;
 csoffset += 15050 ;
 aux_cmp_num += 19;
 }
 }
 {
 uint aux_create = 1;
-int aux_cmp_num = 65+ctx_index+1;
-uint csoffset = mySignalStart+30289;
+int aux_cmp_num = 65+coffset+1;
+uint csoffset = soffset+30289;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "HashState_54_1937";
-HashState_4_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"HashState_54_1937", NULL, 0, 0};
+HashState_4_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+ctx->componentMemory[coffset].subcomponentsParallel[aux_create+i] = true;
 csoffset += 45191 ;
 aux_cmp_num += 70;
 }
 }
 {
 uint aux_create = 2;
-int aux_cmp_num = 46+ctx_index+1;
-uint csoffset = mySignalStart+15239;
+int aux_cmp_num = 46+coffset+1;
+uint csoffset = soffset+15239;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "HashFleet_58_2092";
-HashFleet_2_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"HashFleet_58_2092", NULL, 0, 0};
+HashFleet_2_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
+ctx->componentMemory[coffset].subcomponentsParallel[aux_create+i] = true;
 csoffset += 15050 ;
 aux_cmp_num += 19;
 }
 }
 {
 uint aux_create = 3;
-int aux_cmp_num = 205+ctx_index+1;
-uint csoffset = mySignalStart+120671;
+int aux_cmp_num = 205+coffset+1;
+uint csoffset = soffset+120671;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "ProcessMove_62_2267";
-ProcessMove_9_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"ProcessMove_62_2267", NULL, 0, 0};
+ProcessMove_9_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 243 ;
 aux_cmp_num += 71;
 }
 }
 {
 uint aux_create = 4;
-int aux_cmp_num = 135+ctx_index+1;
-uint csoffset = mySignalStart+75480;
+int aux_cmp_num = 135+coffset+1;
+uint csoffset = soffset+75480;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "HashState_63_2327";
-HashState_4_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"HashState_63_2327", NULL, 0, 0};
+HashState_4_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 45191 ;
 aux_cmp_num += 70;
 }
 }
 {
 uint aux_create = 5;
-int aux_cmp_num = 0+ctx_index+1;
-uint csoffset = mySignalStart+84;
+int aux_cmp_num = 0+coffset+1;
+uint csoffset = soffset+84;
 for (uint i = 0; i < 1; i++) {
-std::string new_cmp_name = "GetSunk_67_2458";
-GetSunk_16_create(csoffset,aux_cmp_num,ctx,new_cmp_name,myId);
-mySubcomponents[aux_create+i] = aux_cmp_num;
+Circom_ComponentName new_cmp_name = {"GetSunk_67_2458", NULL, 0, 0};
+GetSunk_16_create(csoffset,aux_cmp_num,ctx,new_cmp_name,coffset);
+ctx->componentMemory[coffset].subcomponents[aux_create+i] = aux_cmp_num;
 csoffset += 105 ;
 aux_cmp_num += 27;
 }
 }
+}
+
+void UpdateState_17_run(uint ctx_index,Circom_CalcWit* ctx){
+FrElement* signalValues = ctx->signalValues;
+u64 mySignalStart = ctx->componentMemory[ctx_index].signalStart;
+u64 myFather = ctx->componentMemory[ctx_index].idFather;
+u64 myId = ctx_index;
+u32* mySubcomponents = ctx->componentMemory[ctx_index].subcomponents;
+bool* mySubcomponentsParallel = ctx->componentMemory[ctx_index].subcomponentsParallel;
+FrElement* circuitConstants = ctx->circuitConstants;
+std::string* listOfTemplateMessages = ctx->listOfTemplateMessages;
+FrElement expaux[3];
+FrElement lvar[0];
+uint sub_component_aux;
+uint index_multiple_eq;
 {
 uint cmp_index_ref = 0;
 {
@@ -3817,17 +2115,8 @@ Fr_copy(aux_dest,&signalValues[mySignalStart + 62]);
 }
 // need to run sub component
 assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1));
-HashFleet_2_run(mySubcomponents[cmp_index_ref],ctx);
-}
-{
-PFrElement aux_dest = &signalValues[mySignalStart + 63];
-// load src
-// end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[0]].signalStart + 0]);
+ctx->runParallel(HashFleet_2_run,mySubcomponents[cmp_index_ref],ctx->componentMemory[ctx_index].sbct[cmp_index_ref]);
 }
-Fr_eq(&expaux[0],&signalValues[mySignalStart + 7],&signalValues[mySignalStart + 63]); // line circom 51
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 51. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
-assert(Fr_isTrue(&expaux[0]));
 {
 uint cmp_index_ref = 1;
 {
@@ -3860,17 +2149,8 @@ Fr_copy(aux_dest,&signalValues[mySignalStart + 62]);
 }
 // need to run sub component
 assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1));
-HashState_4_run(mySubcomponents[cmp_index_ref],ctx);
-}
-{
-PFrElement aux_dest = &signalValues[mySignalStart + 64];
-// load src
-// end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[1]].signalStart + 0]);
+ctx->runParallel(HashState_4_run,mySubcomponents[cmp_index_ref],ctx->componentMemory[ctx_index].sbct[cmp_index_ref]);
 }
-Fr_eq(&expaux[0],&signalValues[mySignalStart + 8],&signalValues[mySignalStart + 64]); // line circom 55
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 55. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
-assert(Fr_isTrue(&expaux[0]));
 {
 uint cmp_index_ref = 2;
 {
@@ -3892,102 +2172,129 @@ Fr_copy(aux_dest,&signalValues[mySignalStart + 62]);
 }
 // need to run sub component
 assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1));
-HashFleet_2_run(mySubcomponents[cmp_index_ref],ctx);
+ctx->runParallel(HashFleet_2_run,mySubcomponents[cmp_index_ref],ctx->componentMemory[ctx_index].sbct[cmp_index_ref]);
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + 65];
+uint cmp_index_ref = 4;
+{
+PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
 // load src
 // end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[2]].signalStart + 0]);
+Fr_copyn(aux_dest,&signalValues[mySignalStart + 28],17);
+}
+// no need to run sub component
+assert(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 17);
 }
-Fr_eq(&expaux[0],&signalValues[mySignalStart + 9],&signalValues[mySignalStart + 65]); // line circom 59
-if (!Fr_isTrue(&expaux[0])) std::cout << "Failed assert in template/function " << myTemplateName << " line 59. " <<  "Followed trace of components: " << ctx->getTrace(myId) << std::endl;
-assert(Fr_isTrue(&expaux[0]));
 {
-uint cmp_index_ref = 3;
+uint cmp_index_ref = 4;
 {
 PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 18];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + 10]);
+Fr_copyn(aux_dest,&signalValues[mySignalStart + 45],17);
 }
 // no need to run sub component
-assert(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1);
+assert(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 17);
 }
 {
-uint cmp_index_ref = 3;
+uint cmp_index_ref = 4;
 {
-PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 19];
+PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 35];
 // load src
 // end load src
-Fr_copyn(aux_dest,&signalValues[mySignalStart + 11],17);
+Fr_copy(aux_dest,&signalValues[mySignalStart + 62]);
 }
-// no need to run sub component
-assert(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 17);
+// need to run sub component
+assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1));
+HashState_4_run(mySubcomponents[cmp_index_ref],ctx);
 }
 {
-uint cmp_index_ref = 3;
-{
-PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 36];
+PFrElement aux_dest = &signalValues[mySignalStart + 0];
 // load src
 // end load src
-Fr_copyn(aux_dest,&signalValues[mySignalStart + 28],17);
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[4]].signalStart + 0]);
 }
-// need to run sub component
-assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 17));
-ProcessMove_9_run(mySubcomponents[cmp_index_ref],ctx);
+// wait for the parallel sub component
+ctx->joinParallel(ctx->componentMemory[ctx_index].sbct[0]);
+{
+PFrElement aux_dest = &signalValues[mySignalStart + 63];
+// load src
+// end load src
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[0]].signalStart + 0]);
 }
+// wait for the parallel sub component
+ctx->joinParallel(ctx->componentMemory[ctx_index].sbct[1]);
 {
-PFrElement aux_dest = &signalValues[mySignalStart + 66];
+PFrElement aux_dest = &signalValues[mySignalStart + 64];
 // load src
 // end load src
-Fr_copyn(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[3]].signalStart + 0],17);
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[1]].signalStart + 0]);
 }
+// wait for the parallel sub component
+ctx->joinParallel(ctx->componentMemory[ctx_index].sbct[2]);
 {
-PFrElement aux_dest = &signalValues[mySignalStart + 83];
+PFrElement aux_dest = &signalValues[mySignalStart + 65];
 // load src
 // end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[3]].signalStart + 17]);
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[2]].signalStart + 0]);
 }
+// the checks wait for every parallel sub component: a failed one leaves none running
+#ifndef TRUSTED_INPUTS
+Fr_eq(&expaux[0],&signalValues[mySignalStart + 7],&signalValues[mySignalStart + 63]); // line circom 51
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,51);
+assert(Fr_isTrue(&expaux[0]));
+Fr_eq(&expaux[0],&signalValues[mySignalStart + 8],&signalValues[mySignalStart + 64]); // line circom 55
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,55);
+assert(Fr_isTrue(&expaux[0]));
+Fr_eq(&expaux[0],&signalValues[mySignalStart + 9],&signalValues[mySignalStart + 65]); // line circom 59
+if (!Fr_isTrue(&expaux[0])) ctx->failedAssert(myId,59);
+assert(Fr_isTrue(&expaux[0]));
+#endif
 {
-uint cmp_index_ref = 4;
+uint cmp_index_ref = 3;
 {
-PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 1];
+PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 18];
 // load src
 // end load src
-Fr_copyn(aux_dest,&signalValues[mySignalStart + 28],17);
+Fr_copy(aux_dest,&signalValues[mySignalStart + 10]);
 }
 // no need to run sub component
-assert(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 17);
+assert(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1);
 }
 {
-uint cmp_index_ref = 4;
+uint cmp_index_ref = 3;
 {
-PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 18];
+PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 19];
 // load src
 // end load src
-Fr_copyn(aux_dest,&signalValues[mySignalStart + 45],17);
+Fr_copyn(aux_dest,&signalValues[mySignalStart + 11],17);
 }
 // no need to run sub component
 assert(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 17);
 }
 {
-uint cmp_index_ref = 4;
+uint cmp_index_ref = 3;
 {
-PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 35];
+PFrElement aux_dest = &ctx->signalValues[ctx->componentMemory[mySubcomponents[cmp_index_ref]].signalStart + 36];
 // load src
 // end load src
-Fr_copy(aux_dest,&signalValues[mySignalStart + 62]);
+Fr_copyn(aux_dest,&signalValues[mySignalStart + 28],17);
 }
 // need to run sub component
-assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 1));
-HashState_4_run(mySubcomponents[cmp_index_ref],ctx);
+assert(!(ctx->componentMemory[mySubcomponents[cmp_index_ref]].inputCounter -= 17));
+ProcessMove_9_run(mySubcomponents[cmp_index_ref],ctx);
 }
 {
-PFrElement aux_dest = &signalValues[mySignalStart + 0];
+PFrElement aux_dest = &signalValues[mySignalStart + 66];
 // load src
 // end load src
-Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[4]].signalStart + 0]);
+Fr_copyn(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[3]].signalStart + 0],17);
+}
+{
+PFrElement aux_dest = &signalValues[mySignalStart + 83];
+// load src
+// end load src
+Fr_copy(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[3]].signalStart + 17]);
 }
 {
 PFrElement aux_dest = &signalValues[mySignalStart + 1];
@@ -4013,14 +2320,13 @@ PFrElement aux_dest = &signalValues[mySignalStart + 2];
 // end load src
 Fr_copyn(aux_dest,&ctx->signalValues[ctx->componentMemory[mySubcomponents[5]].signalStart + 0],5);
 }
-for (uint i = 0; i < 6; i++){
-uint index_subc = ctx->componentMemory[ctx_index].subcomponents[i];
-if (index_subc != 0)release_memory_component(ctx,index_subc);
 }
+
+void create_components(Circom_CalcWit* ctx){
+UpdateState_17_create(1,0,ctx,{"main", NULL, 0, 0},0);
 }
 
 void run(Circom_CalcWit* ctx){
-UpdateState_17_create(1,0,ctx,"main",0);
 UpdateState_17_run(0,ctx);
 }
 
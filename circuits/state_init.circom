@@ -87,7 +87,7 @@ template InitState() {
     
     // Flatten the placed fleet and hash it
     signal flatFleet[17] <== FlattenFleet()(patrol_p, submarine_p, destroyer_p, battleship_p, carrier_p);
-    fleetHash <== HashFleet()(flatFleet, secret);
+    fleetHash <== parallel HashFleet()(flatFleet, secret);
 
     // Generate the initial no-hits-registered game state and hash it
     signal state[17];
@@ -97,7 +97,7 @@ template InitState() {
     stateHash <== HashState()(state, salt, secret);
 
     // Generate the salt hash to commit to
-    saltHash <== HashFleet()(salt, secret);
+    saltHash <== parallel HashFleet()(salt, secret);
 }
 
 component main = InitState();
\ No newline at end of file
@@ -47,15 +47,15 @@ template UpdateState() {
     signal output isSunk[5];
     
     // Ensure that the fleet being used matches the public commitment
-    signal HFleet <== HashFleet()(fleet, secret);
+    signal HFleet <== parallel HashFleet()(fleet, secret);
     fleetHash === HFleet;
 
     // Ensure that the state being used matches the public commitment
-    signal HState <== HashState()(state, salt, secret);
+    signal HState <== parallel HashState()(state, salt, secret);
     stateHash === HState;
 
     // Ensure that the salt being used matches the public commitment
-    signal HSalt <== HashFleet()(salt, secret);
+    signal HSalt <== parallel HashFleet()(salt, secret);
     saltHash === HSalt;
 
     // Validate the move, and get the new state hash and whether the move was a hit